@@ -0,0 +1,166 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "keyple/core/util/cpp/Logger.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
+#include "keyple/plugin/pcsc/KeyplePluginPcscExport.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
+
+/**
+ * Index of card descriptions addressed by ATR.
+ *
+ * <p>The index is loaded from a text database in the format of the
+ * "smartcard_list.txt" file maintained by the pcsc-tools project:
+ *
+ * <ul>
+ *   <li>lines starting with '#' are comments,
+ *   <li>an ATR line contains hexadecimal bytes separated by spaces, where '.'
+ *       stands for any hexadecimal digit (e.g. "3B 8F 80 01 80 4F 0C A0 .."),
+ *   <li>the tab-indented lines following an ATR line are its descriptions.
+ * </ul>
+ *
+ * <p>ATR patterns are stored in a nibble trie with a wildcard branch, so a
+ * lookup only costs a walk along the ATR, independently of the size of the
+ * database. Patterns using regular expression constructs other than '.' are
+ * not supported and are ignored when loading.
+ *
+ * @since 2.6.0
+ */
+class KEYPLEPLUGINPCSC_API PcscAtrIdentificationIndex final {
+public:
+    /**
+     * Creates an empty index.
+     *
+     * @since 2.6.0
+     */
+    PcscAtrIdentificationIndex();
+
+    /**
+     * Creates an index from the database file whose path is provided.
+     *
+     * @param path The path of the database file.
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the file cannot be read.
+     * @since 2.6.0
+     */
+    static std::shared_ptr<PcscAtrIdentificationIndex> loadFromFile(
+        const std::string& path);
+
+    /**
+     * Adds to the index all the entries read from the provided stream.
+     *
+     * @param input A stream providing the database content.
+     * @since 2.6.0
+     */
+    void load(std::istream& input);
+
+    /**
+     * Adds an entry to the index.
+     *
+     * @param atrPattern An ATR pattern such as "3B 8F 80 01 80 4F 0C A0 ..".
+     * @param description The description associated with the pattern.
+     * @return False if the pattern is not supported, true otherwise.
+     * @since 2.6.0
+     */
+    bool addEntry(const std::string& atrPattern, const std::string& description);
+
+    /**
+     * Gets the descriptions of the most specific pattern matching the whole
+     * ATR provided.
+     *
+     * <p>When several patterns match, the one having the longest exact prefix
+     * is retained.
+     *
+     * @param atr The ATR of the card.
+     * @return An empty vector if the ATR is not referenced.
+     * @since 2.6.0
+     */
+    const std::vector<std::string>& identify(const std::vector<uint8_t>& atr) const;
+
+    /**
+     * Gets the descriptions associated with the provided power-on data.
+     *
+     * @param powerOnData The ATR as an hexadecimal string, as provided by the
+     *        power-on data of the reader.
+     * @return An empty vector if the ATR is not referenced or malformed.
+     * @since 2.6.0
+     */
+    const std::vector<std::string>& identify(const std::string& powerOnData) const;
+
+    /**
+     * Gets the number of distinct ATR patterns in the index.
+     *
+     * @return A positive integer or zero.
+     * @since 2.6.0
+     */
+    size_t size() const;
+
+private:
+    /**
+     * A trie node, children 0 to 15 are the nibble values, 16 is the wildcard.
+     */
+    struct Node {
+        int32_t mChildren[17];
+        int32_t mEntry;
+
+        Node();
+    };
+
+    /**
+     *
+     */
+    static const int WILDCARD = 16;
+
+    /**
+     *
+     */
+    const std::unique_ptr<Logger> mLogger =
+        LoggerFactory::getLogger(typeid(PcscAtrIdentificationIndex));
+
+    /**
+     * Trie nodes, the root is at index 0.
+     */
+    std::vector<Node> mNodes;
+
+    /**
+     * Descriptions of the patterns, addressed by Node::mEntry.
+     */
+    std::vector<std::vector<std::string>> mEntries;
+
+    /**
+     *
+     */
+    int32_t find(
+        const std::vector<uint8_t>& atr,
+        const size_t nibbleIndex,
+        const int32_t nodeIndex) const;
+};
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,56 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#pragma once
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+/**
+ * Ways of allocating the PC/SC contexts used to communicate with the readers
+ * and cards.
+ *
+ * <p>pcsc-lite serializes the calls made on a same context, allocating
+ * several contexts allows exchanges with different readers to be processed
+ * in parallel.
+ *
+ * @since 2.6.0
+ */
+enum class PcscContextMode {
+    /**
+     * A single context is shared by all the readers (default).
+     *
+     * @since 2.6.0
+     */
+    SHARED,
+
+    /**
+     * Each reader uses its own context.
+     *
+     * @since 2.6.0
+     */
+    PER_READER,
+
+    /**
+     * Each thread uses its own context, released when the thread exits.
+     *
+     * @since 2.6.0
+     */
+    PER_THREAD
+};
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
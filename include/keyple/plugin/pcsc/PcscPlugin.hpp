@@ -13,6 +13,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "keyple/core/common/KeyplePluginExtension.hpp"
 
 namespace keyple {
@@ -32,6 +35,19 @@ public:
      * Visrtual destructor.
      */
     virtual ~PcscPlugin() = default;
+
+    /**
+     * Gets the descriptions of the card type corresponding to the provided
+     * power-on data, using the ATR identification database configured with
+     * PcscPluginFactoryBuilder::Builder::useAtrIdentificationDatabase.
+     *
+     * @param powerOnData The ATR of the card as an hexadecimal string.
+     * @return An empty vector if no database is configured or if the ATR is not
+     *         referenced.
+     * @since 2.6.0
+     */
+    virtual const std::vector<std::string>& identifyCard(
+        const std::string& powerOnData) const = 0;
 };
 
 } /* namespace pcsc */
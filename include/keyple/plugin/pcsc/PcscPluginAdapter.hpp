@@ -13,9 +13,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "keyple/core/plugin/spi/ObservablePluginSpi.hpp"
@@ -23,10 +27,18 @@
 #include "keyple/core/util/cpp/Logger.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
 #include "keyple/core/util/cpp/Pattern.hpp"
+#include "keyple/plugin/pcsc/PcscAtrIdentificationIndex.hpp"
 #include "keyple/plugin/pcsc/PcscPlugin.hpp"
+#include "keyple/plugin/pcsc/PcscPluginFactoryBuilder.hpp"
 #include "keyple/plugin/pcsc/PcscReaderAdapter.hpp"
+#include "keyple/plugin/pcsc/PcscReaderCapabilityCache.hpp"
+#include "keyple/plugin/pcsc/PcscReaderExecutor.hpp"
+#include "keyple/plugin/pcsc/PcscReaderProfile.hpp"
+#include "keyple/plugin/pcsc/cpp/AccessCoordinator.hpp"
+#include "keyple/plugin/pcsc/cpp/Card.hpp"
 #include "keyple/plugin/pcsc/cpp/CardTerminal.hpp"
 #include "keyple/plugin/pcsc/cpp/CardTerminals.hpp"
+#include "keyple/plugin/pcsc/cpp/TerminalFactory.hpp"
 
 namespace keyple {
 namespace plugin {
@@ -37,8 +49,12 @@ using keyple::core::plugin::spi::reader::ReaderSpi;
 using keyple::core::util::cpp::Logger;
 using keyple::core::util::cpp::LoggerFactory;
 using keyple::core::util::cpp::Pattern;
+using keyple::plugin::pcsc::cpp::AccessCoordinator;
 using keyple::plugin::pcsc::cpp::CardTerminal;
 using keyple::plugin::pcsc::cpp::CardTerminals;
+using keyple::plugin::pcsc::cpp::TerminalFactory;
+
+using ContextMode = PcscPluginFactoryBuilder::ContextMode;
 
 class PcscReaderAdapter;
 
@@ -55,6 +71,9 @@ public:
     /**
      * Gets the single instance.
      *
+     * <p>The instance is created in a thread-safe way on first call. It uses
+     * the default plugin name and the default terminal factory.
+     *
      * @return This instance.
      * @since 2.0.0
      */
@@ -113,10 +132,12 @@ public:
      * <p>The aim is to handle the exception possibly raised by the underlying
      * smartcard.io method.
      *
+     * <p>The same list is returned as long as the readers do not change.
+     *
      * @return An empty list if no reader is available.
      * @throws PluginIOException If an error occurs while accessing the list.
      */
-    const std::vector<std::shared_ptr<CardTerminal>> getCardTerminalList();
+    std::shared_ptr<const CardTerminals::TerminalList> getCardTerminalList();
 
 
     /**
@@ -149,6 +170,118 @@ public:
      */
     bool isContactless(const std::string& readerName);
 
+    /**
+     * Gets the profile of the reader whose name is provided.
+     *
+     * <p>The profile is computed on the first call for a given name and then
+     * kept in a plugin-level cache, so that it is reused by all the reader
+     * adapters created later for the same reader name.
+     *
+     * @param readerName A string containing the reader name
+     * @return A not null reference.
+     * @since 2.6.0
+     */
+    std::shared_ptr<PcscReaderProfile> getReaderProfile(
+        const std::string& readerName);
+
+    /**
+     * Gets the names of the readers handled by this plugin belonging to the
+     * provided physical device.
+     *
+     * <p>The names are taken from the terminals registry, without querying
+     * the PC/SC service.
+     *
+     * @param deviceName The device name (see PcscReaderProfile::getDeviceName).
+     * @return A list of reader names, possibly empty.
+     * @since 2.6.0
+     */
+    const std::vector<std::string> getDeviceReaderNames(
+        const std::string& deviceName);
+
+    /**
+     * Completes the profile of the reader whose name is provided with the
+     * capabilities read from the reader through the provided card.
+     *
+     * <p>When another slot of the same physical device has already been
+     * probed, its capabilities are reused without querying the reader. When
+     * the profile was restored from the capability cache, only the firmware
+     * attributes are read to check that the cached values are still
+     * relevant. Nothing is done if the profile was already validated.
+     *
+     * <p>Failures are logged and ignored, the capabilities being optional.
+     *
+     * @param readerName A string containing the reader name
+     * @param card A card connected to the reader (possibly in direct mode).
+     * @since 2.6.0
+     */
+    void validateReaderProfile(
+        const std::string& readerName, const std::shared_ptr<Card> card);
+
+    /**
+     * Persists the provided profile in the capability cache, if any.
+     *
+     * @param profile The profile to persist.
+     * @since 2.6.0
+     */
+    void storeReaderProfile(const std::shared_ptr<PcscReaderProfile> profile);
+
+    /**
+     * Sets the cache where the reader capabilities are persisted.
+     *
+     * @param readerCapabilityCache The cache, null to disable persistence.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setReaderCapabilityCache(
+        const std::shared_ptr<PcscReaderCapabilityCache> readerCapabilityCache);
+
+    /**
+     * Sets the coordinator of the accesses to the readers shared with other
+     * applications.
+     *
+     * @param accessCoordinator The coordinator, null to keep the default one.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setAccessCoordinator(
+        const std::shared_ptr<AccessCoordinator> accessCoordinator);
+
+    /**
+     * Restricts the readers handled by this plugin to those whose name
+     * matches the provided filter.
+     *
+     * @param readerInclusionFilter A regular expression pattern, null to
+     *        handle all the readers.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setReaderInclusionFilterPattern(
+        const std::shared_ptr<Pattern> readerInclusionFilter);
+
+    /**
+     * Excludes from the readers handled by this plugin those whose name
+     * matches the provided filter.
+     *
+     * @param readerExclusionFilter A regular expression pattern, null to
+     *        exclude no reader.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setReaderExclusionFilterPattern(
+        const std::shared_ptr<Pattern> readerExclusionFilter);
+
+    /**
+     * Sets the filter to identify contact readers, taking precedence over the
+     * contactless reader filter.
+     *
+     * @param contactReaderIdentificationFilter A regular expression pattern,
+     *        null to rely on the contactless reader filter only.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setContactReaderIdentificationFilterPattern(
+        const std::shared_ptr<Pattern> contactReaderIdentificationFilter);
+
     /**
      * Sets the filter to identify contactless readers.
      *
@@ -183,6 +316,124 @@ public:
     PcscPluginAdapter& setCardMonitoringCycleDuration(
         const int cardMonitoringCycleDuration);
 
+    /**
+     * Sets the index used to identify the cards from their ATR.
+     *
+     * @param atrIdentificationIndex The index, null to disable the
+     *        identification.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setAtrIdentificationIndex(
+        const std::shared_ptr<PcscAtrIdentificationIndex> atrIdentificationIndex);
+
+    /**
+     * Sets the way PC/SC contexts are allocated to the readers.
+     *
+     * @param contextMode The context mode.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setContextMode(const ContextMode contextMode);
+
+    /**
+     * Enables or disables the lazy initialization of the terminals.
+     *
+     * <p>When enabled, the PC/SC context and the list of readers are
+     * initialized by a background thread started on the first search, the
+     * searches returning no reader until this initialization completes.
+     *
+     * @param isLazyInitialization True to enable the lazy initialization.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setLazyInitialization(const bool isLazyInitialization);
+
+    /**
+     * Enables or disables the connection to the cards as soon as their
+     * insertion is detected.
+     *
+     * @param isSpeculativeConnection True to enable the speculative connection.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setSpeculativeConnection(
+        const bool isSpeculativeConnection);
+
+    /**
+     * Indicates whether the readers must connect to the cards as soon as their
+     * insertion is detected.
+     *
+     * @return True if the speculative connection is enabled.
+     * @since 2.6.0
+     */
+    bool isSpeculativeConnection() const;
+
+    /**
+     * Enables or disables the reuse of the card connections from one session
+     * to the next.
+     *
+     * @param isSessionReuse True to enable the session reuse.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setSessionReuse(const bool isSessionReuse);
+
+    /**
+     * Indicates whether the card connections are kept from one session to the
+     * next.
+     *
+     * @return True if the session reuse is enabled.
+     * @since 2.6.0
+     */
+    bool isSessionReuse() const;
+
+    /**
+     * Sets the capacity of the command queue created for each reader.
+     *
+     * @param capacity The maximum number of pending operations, 0 for no
+     *        command queue.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setReaderCommandQueueCapacity(const int capacity);
+
+    /**
+     * Gets the capacity of the command queue created for each reader.
+     *
+     * @return 0 if the readers have no command queue.
+     * @since 2.6.0
+     */
+    int getReaderCommandQueueCapacity() const;
+
+    /**
+     * Sets the number of workers of the executor shared by the command queues
+     * of the readers.
+     *
+     * @param threadCount The number of workers, 0 to give each command queue
+     *        its own worker thread.
+     * @return The object instance.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter& setReaderExecutorThreadCount(const int threadCount);
+
+    /**
+     * Gets the executor shared by the command queues of the readers, started
+     * on first call.
+     *
+     * @return Null if each command queue has its own worker thread.
+     * @since 2.6.0
+     */
+    std::shared_ptr<PcscReaderExecutor> getReaderExecutor();
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    const std::vector<std::string>& identifyCard(
+        const std::string& powerOnData) const override;
+
     /**
      * Constructor.
      *
@@ -190,6 +441,29 @@ public:
      */
     PcscPluginAdapter();
 
+    /**
+     * Creates a plugin independent of the single instance.
+     *
+     * <p>Each plugin created this way has its own configuration and accesses
+     * the readers through the provided terminal factory, and thus through its
+     * own PC/SC context when the factory is not the default one.
+     *
+     * @param name The plugin name, must be unique among the registered
+     *        plugins.
+     * @param terminalFactory The terminal factory to use.
+     * @since 2.6.0
+     */
+    PcscPluginAdapter(
+        const std::string& name,
+        std::shared_ptr<TerminalFactory> terminalFactory);
+
+    /**
+     * Waits for the end of the background initialization of the terminals.
+     *
+     * @since 2.6.0
+     */
+    ~PcscPluginAdapter();
+
 private:
     /**
      *
@@ -199,14 +473,25 @@ private:
 
     /**
      * Singleton instance of the class
-     *
-     * <p>'volatile' qualifier ensures that read access to the object will only
-     * be allowed once the object has been fully initialized. <br>
-     * This qualifier is required for "lazy-singleton" pattern with double-check
-     * method, to be thread-safe.
      */
     static std::shared_ptr<PcscPluginAdapter> INSTANCE;
 
+    /**
+     * Guarantees that the singleton is created only once, even when
+     * getInstance() is called concurrently.
+     */
+    static std::once_flag INSTANCE_FLAG;
+
+    /**
+     *
+     */
+    const std::string mName;
+
+    /**
+     *
+     */
+    const std::shared_ptr<TerminalFactory> mTerminalFactory;
+
     /**
      *
      */
@@ -218,24 +503,218 @@ private:
     std::map<std::string, std::string> mProtocolRulesMap;
 
     /**
-     *
+     * Accessed through std::atomic_load/std::atomic_store, it may be published
+     * by the background initialization thread.
      */
     std::shared_ptr<CardTerminals> mTerminals;
 
     /**
      *
      */
-    bool mIsCardTerminalsInitialized;
+    std::atomic<bool> mIsCardTerminalsInitialized;
+
+    /**
+     * Serializes the creation of the terminals registry.
+     */
+    std::mutex mTerminalsMutex;
+
+    /**
+     * Gets the terminals registry, creating it on first call.
+     */
+    std::shared_ptr<CardTerminals> getTerminals();
+
+    /**
+     * Updates the terminals registry and gets the list of the terminals
+     * included by the filters.
+     *
+     * @throw Exception If the PC/SC service can not be accessed.
+     */
+    std::shared_ptr<const CardTerminals::TerminalList> updateCardTerminalList();
+
+    /**
+     * Protects the lists derived from the terminals registry.
+     */
+    std::mutex mTerminalListMutex;
+
+    /**
+     * Terminals of the readers handled by the plugin, and the registry list
+     * they were filtered from.
+     */
+    std::shared_ptr<const CardTerminals::TerminalList> mIncludedTerminals;
+    std::shared_ptr<const CardTerminals::TerminalList> mIncludedTerminalsSource;
+
+    /**
+     * Names of the readers handled by the plugin, and the list of terminals
+     * they were read from.
+     */
+    std::vector<std::string> mReaderNames;
+    std::shared_ptr<const CardTerminals::TerminalList> mReaderNamesSource;
+
+    /**
+     *
+     */
+    bool mIsLazyInitialization;
+
+    /**
+     *
+     */
+    bool mIsSpeculativeConnection;
+
+    /**
+     *
+     */
+    bool mIsSessionReuse;
+
+    /**
+     *
+     */
+    int mReaderCommandQueueCapacity;
+
+    /**
+     *
+     */
+    int mReaderExecutorThreadCount;
+
+    /**
+     *
+     */
+    std::shared_ptr<PcscReaderExecutor> mReaderExecutor;
+
+    /**
+     *
+     */
+    std::mutex mReaderExecutorMutex;
+
+    /**
+     * Set when the background initialization of the terminals is running or
+     * completed.
+     */
+    std::atomic<bool> mIsBackgroundInitializationStarted;
+
+    /**
+     * Set when the terminals are initialized, in lazy initialization mode.
+     */
+    std::atomic<bool> mIsTerminalsReady;
+
+    /**
+     * Background initialization of the terminals, in lazy initialization
+     * mode.
+     */
+    std::thread mInitializationThread;
+
+    /**
+     *
+     */
+    std::mutex mInitializationThreadMutex;
+
+    /**
+     * Waits for the end of the background initialization, if any.
+     */
+    void joinInitializationThread();
+
+    /**
+     * Indicates whether the terminals can be accessed without blocking,
+     * starting their background initialization if needed.
+     *
+     * @return False if the lazy initialization is enabled and not completed.
+     */
+    bool isTerminalsReady();
 
     /**
      *
      */
     std::shared_ptr<Pattern> mContactlessReaderIdentificationFilterPattern;
 
+    /**
+     *
+     */
+    std::shared_ptr<Pattern> mReaderInclusionFilterPattern;
+
+    /**
+     *
+     */
+    std::shared_ptr<Pattern> mReaderExclusionFilterPattern;
+
+    /**
+     *
+     */
+    std::shared_ptr<Pattern> mContactReaderIdentificationFilterPattern;
+
+    /**
+     * Indicates whether the reader whose name is provided is handled by this
+     * plugin.
+     */
+    bool isReaderIncluded(const std::string& readerName) const;
+
+    /**
+     * Finds the profile of another slot of the same physical device whose
+     * capabilities have already been validated.
+     *
+     * @return Null if no such profile exists.
+     */
+    std::shared_ptr<PcscReaderProfile> findValidatedDeviceProfile(
+        const std::shared_ptr<PcscReaderProfile> profile);
+
+    /**
+     * Reader profiles indexed by reader name.
+     */
+    std::map<std::string, std::shared_ptr<PcscReaderProfile>> mReaderProfiles;
+
+    /**
+     *
+     */
+    std::mutex mReaderProfilesMutex;
+
+    /**
+     *
+     */
+    std::shared_ptr<PcscReaderCapabilityCache> mReaderCapabilityCache;
+
+    /**
+     * Reader adapters created by the plugin, indexed by reader name and kept
+     * in sync with the terminals registry.
+     */
+    std::unordered_map<std::string, std::shared_ptr<PcscReaderAdapter>>
+        mReaderAdapters;
+
+    /**
+     *
+     */
+    std::mutex mReaderAdaptersMutex;
+
+    /**
+     * Gets the reader adapter associated with the provided terminal, creating
+     * it if needed.
+     */
+    std::shared_ptr<PcscReaderAdapter> getOrCreateReader(
+        std::shared_ptr<CardTerminal> terminal);
+
+    /**
+     * Creates the adapter of the provided terminal and performs the initial
+     * probing of the reader.
+     */
+    std::shared_ptr<PcscReaderAdapter> bringUpReader(
+        std::shared_ptr<CardTerminal> terminal);
+
     /**
      *
      */
     int mCardMonitoringCycleDuration;
+
+    /**
+     *
+     */
+    std::shared_ptr<PcscAtrIdentificationIndex> mAtrIdentificationIndex;
+
+    /**
+     *
+     */
+    ContextMode mContextMode;
+
+    /**
+     *
+     */
+    std::shared_ptr<AccessCoordinator> mAccessCoordinator;
 };
 
 } /* namespace pcsc */
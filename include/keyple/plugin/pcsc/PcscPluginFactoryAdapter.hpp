@@ -19,7 +19,11 @@
 #include "keyple/core/plugin/spi/PluginFactorySpi.hpp"
 #include "keyple/core/plugin/spi/PluginSpi.hpp"
 #include "keyple/core/util/cpp/Pattern.hpp"
+#include "keyple/plugin/pcsc/PcscAtrIdentificationIndex.hpp"
 #include "keyple/plugin/pcsc/PcscPluginFactory.hpp"
+#include "keyple/plugin/pcsc/PcscPluginFactoryBuilder.hpp"
+#include "keyple/plugin/pcsc/PcscReaderCapabilityCache.hpp"
+#include "keyple/plugin/pcsc/cpp/AccessCoordinator.hpp"
 
 namespace keyple {
 namespace plugin {
@@ -29,6 +33,8 @@ using keyple::core::plugin::spi::PluginFactorySpi;
 using keyple::core::plugin::spi::PluginSpi;
 using keyple::core::util::cpp::Pattern;
 
+using ContextMode = PcscPluginFactoryBuilder::ContextMode;
+
 /**
  * Factory of PcscPlugin.
  *
@@ -45,16 +51,39 @@ public:
      */
     static const std::string PLUGIN_NAME;
 
+    /**
+     * (package-private)<br>
+     * Plugin settings collected by the factory builder.
+     *
+     * @since 2.6.0
+     */
+    struct Configuration {
+        std::shared_ptr<Pattern> contactlessReaderIdentificationFilterPattern;
+        std::shared_ptr<Pattern> contactReaderIdentificationFilterPattern;
+        std::map<std::string, std::string> protocolRulesMap;
+        int cardMonitoringCycleDuration;
+        std::shared_ptr<PcscAtrIdentificationIndex> atrIdentificationIndex;
+        ContextMode contextMode;
+        bool isLazyInitialization;
+        bool isSpeculativeConnection;
+        bool isSessionReuse;
+        int readerCommandQueueCapacity;
+        int readerExecutorThreadCount;
+        std::string pluginName;
+        std::shared_ptr<Pattern> readerInclusionFilterPattern;
+        std::shared_ptr<Pattern> readerExclusionFilterPattern;
+        std::shared_ptr<PcscReaderCapabilityCache> readerCapabilityCache;
+        std::shared_ptr<cpp::AccessCoordinator> accessCoordinator;
+    };
+
     /**
      * (package-private)<br>
      * Creates an instance, sets the fields from the factory builder.
      *
+     * @param configuration The settings of the plugin.
      * @since 2.0.0
      */
-    PcscPluginFactoryAdapter(
-        const std::shared_ptr<Pattern> contactlessReaderIdentificationFilterPattern,
-        const std::map<std::string, std::string>& protocolRulesMap,
-        const int cardMonitoringCycleDuration);
+    explicit PcscPluginFactoryAdapter(const Configuration& configuration);
 
     /**
      * {@inheritDoc}
@@ -80,6 +109,11 @@ public:
     /**
      * {@inheritDoc}
      *
+     * <p>With the default plugin name, the plugin is a single instance shared
+     * by all the factories: the settings of the factory whose getPlugin() is
+     * called last apply. Factories built with different settings must be
+     * given different plugin names to get distinct instances.
+     *
      * @since 2.0.0
      */
     std::shared_ptr<PluginSpi> getPlugin() override;
@@ -88,18 +122,7 @@ private:
     /**
      *
      */
-    const std::map<std::string, std::string> mProtocolRulesMap;
-
-    /**
-     *
-     */
-    const std::shared_ptr<Pattern>
-        mContactlessReaderIdentificationFilterPattern;
-
-    /**
-     *
-     */
-    const int mCardMonitoringCycleDuration;
+    const Configuration mConfiguration;
 };
 
 } /* namespace pcsc */
@@ -19,6 +19,9 @@
 
 #include "keyple/core/util/cpp/Pattern.hpp"
 #include "keyple/plugin/pcsc/KeyplePluginPcscExport.hpp"
+#include "keyple/plugin/pcsc/PcscAtrIdentificationIndex.hpp"
+#include "keyple/plugin/pcsc/PcscContextMode.hpp"
+#include "keyple/plugin/pcsc/PcscReaderCapabilityCache.hpp"
 #include "keyple/plugin/pcsc/PcscPluginFactory.hpp"
 
 namespace keyple {
@@ -40,6 +43,12 @@ using keyple::core::util::cpp::Pattern;
  */
 class KEYPLEPLUGINPCSC_API PcscPluginFactoryBuilder final {
 public:
+    /**
+     * Ways of allocating the PC/SC contexts (see PcscContextMode).
+     *
+     * @since 2.6.0
+     */
+    using ContextMode = PcscContextMode;
 
     /**
      * Builder to build a PcscPluginFactory.
@@ -67,11 +76,16 @@ public:
          * Thus, an application using these readers should call this method with
          * {@code ".*(Cherry TC|Identive).*"} as an argument.
          *
+         * <p>A reader matching this filter is considered contact type even if
+         * it also matches the contactless reader filter.
+         *
          * @param contactReaderIdentificationFilter A string a regular
          *        expression.
          * @return This builder.
+         * @throw IllegalArgumentException If the provided string is empty or
+         *        invalid.
          * @since 2.0.0
-         * @deprecated Useless method that will be removed soon, see
+         * @deprecated Will be removed soon, see
          *             #useContactlessReaderIdentificationFilter(String)
          */
         Builder& useContactReaderIdentificationFilter(
@@ -145,6 +159,261 @@ public:
          */
         Builder& setCardMonitoringCycleDuration(const int cycleDuration);
 
+        /**
+         * Sets the name of the plugin.
+         *
+         * <p>Setting a name other than the default one creates a plugin
+         * instance independent of the default instance, with its own PC/SC
+         * context, its own rules and, if a reader inclusion filter is set, its
+         * own subset of readers. Several plugins can thus be registered, e.g.
+         * to isolate a SAM rack from the customer-facing readers.
+         *
+         * <p>The default value is "PcscPlugin".
+         *
+         * @param pluginName The plugin name, must be unique among the plugins
+         *        registered in the smart card service.
+         * @return This builder.
+         * @throw IllegalArgumentException If the name is empty.
+         * @since 2.6.0
+         */
+        Builder& setPluginName(const std::string& pluginName);
+
+        /**
+         * Restricts the readers handled by the plugin to those whose name
+         * matches the provided regular expression.
+         *
+         * <p>By default, all the readers are handled.
+         *
+         * @param readerInclusionFilter A regular expression.
+         * @return This builder.
+         * @throw IllegalArgumentException If the provided string is empty or
+         *        invalid.
+         * @since 2.6.0
+         */
+        Builder& useReaderInclusionFilter(const std::string& readerInclusionFilter);
+
+        /**
+         * Excludes from the readers handled by the plugin those whose name
+         * matches the provided regular expression (e.g. built-in laptop slots
+         * or virtual readers).
+         *
+         * <p>The exclusion filter is applied after the inclusion filter, if
+         * any. No reader adapter is created for an excluded reader, which is
+         * therefore neither monitored nor accessed.
+         *
+         * <p>By default, no reader is excluded.
+         *
+         * @param readerExclusionFilter A regular expression.
+         * @return This builder.
+         * @throw IllegalArgumentException If the provided string is empty or
+         *        invalid.
+         * @since 2.6.0
+         */
+        Builder& useReaderExclusionFilter(const std::string& readerExclusionFilter);
+
+        /**
+         * Sets the way PC/SC contexts are allocated to the readers.
+         *
+         * <p>With ContextMode::PER_READER or ContextMode::PER_THREAD, the
+         * exchanges with different readers performed from different threads
+         * are no longer serialized on a single context by the PC/SC service.
+         *
+         * <p>The default value is ContextMode::SHARED.
+         *
+         * @param contextMode The context mode.
+         * @return This builder.
+         * @since 2.6.0
+         */
+        Builder& setContextMode(const ContextMode contextMode);
+
+        /**
+         * Defers the access to the PC/SC service until after the plugin
+         * registration.
+         *
+         * <p>By default, the PC/SC context is established and the readers are
+         * listed during the plugin registration, which blocks the application
+         * start when the PC/SC service is slow or still starting.<br>
+         * In lazy mode, the registration returns immediately with no reader,
+         * the context and the list of readers being initialized in the
+         * background. The readers are then announced by the plugin monitoring
+         * as they are discovered, like readers connected later.
+         *
+         * <p>This mode therefore requires the plugin to be observed: the
+         * monitoring only runs while an observer is registered, and without it
+         * the readers discovered in the background are never added to the
+         * plugin.
+         *
+         * @return This builder.
+         * @since 2.6.0
+         */
+        Builder& useLazyInitialization();
+
+        /**
+         * Makes the readers connect to a card as soon as its insertion is
+         * detected, in parallel with the processing of the insertion event.
+         *
+         * <p>The connection (card activation, PPS) is then usually established
+         * when the first APDU is to be sent, which shortens the time between
+         * the card insertion and the first response. The reader logs this time
+         * for each card, whether this mode is used or not.
+         *
+         * <p>The connection being made by the worker of the reader, implies a
+         * command queue per reader, of capacity 64 unless set by
+         * useReaderCommandQueue(int).
+         *
+         * <p>By default, the connection is established on the first exchange.
+         *
+         * @return This builder.
+         * @since 2.6.0
+         */
+        Builder& useSpeculativeConnection();
+
+        /**
+         * Keeps the connection to the card when the physical channel is
+         * closed, so that it can be reused by the next session with the same
+         * card.
+         *
+         * <p>The card is then left as is (SCARD_LEAVE_CARD) at the end of a
+         * session. When the next session starts, the card event counter of the
+         * reader is checked: if no card removal or insertion occurred
+         * meanwhile, the connection is reused without connecting again;
+         * otherwise a new connection is established.
+         *
+         * <p>This applies to readers not observed, observed readers keeping
+         * the connection until the card is removed. The disconnection mode is
+         * applied when the card presence is checked or when the connection
+         * cannot be reused.
+         *
+         * @return This builder.
+         * @since 2.6.0
+         */
+        Builder& useSessionReuse();
+
+        /**
+         * Retries the connections and the transactions refused because the
+         * reader or the card is in use by another application
+         * (SCARD_E_SHARING_VIOLATION), typically a SAM reader shared by
+         * several processes.
+         *
+         * <p>The delay between two attempts grows exponentially up to the
+         * provided maximum, and is randomized so that the competing
+         * processes do not retry in lockstep. The time spent waiting is
+         * logged.
+         *
+         * <p>By default, a refused access fails at once.
+         *
+         * @param maxAttempts The maximum number of attempts, at least 1.
+         * @param maxBackoff The maximum delay between two attempts, in
+         *        milliseconds.
+         * @return This builder.
+         * @throw IllegalArgumentException If a value is out of range.
+         * @since 2.6.0
+         */
+        Builder& useSharedAccessRetry(
+            const int maxAttempts, const int maxBackoff);
+
+        /**
+         * Orders the connections and the transactions on each reader across
+         * the processes of the host using this option, with a ticket lock held
+         * in shared memory: the processes are served in the order of their
+         * requests, giving them a predictable latency under contention.
+         *
+         * <p>A process holding its ticket for more than 2 seconds is
+         * skipped. Not available on Windows, where this option is ignored.
+         *
+         * @return This builder.
+         * @since 2.6.0
+         */
+        Builder& useCrossProcessAccessLock();
+
+        /**
+         * Gives each reader a worker thread executing its card and reader
+         * operations in order from a bounded queue (actor mode).
+         *
+         * <p>The operations can then be submitted asynchronously through the
+         * PcscReader::transmitApduAsync, transmitControlCommandAsync and
+         * connectAsync methods, which return futures or take callbacks, so
+         * that an application does not need a blocked thread per reader. The
+         * synchronous operations are executed by the worker as well.
+         *
+         * <p>The depth of the queue and the time spent in it are available
+         * from PcscReader::getCommandQueueStatistics.
+         *
+         * <p>By default, the operations run on the thread of the caller.
+         *
+         * @param capacity The maximum number of pending operations per
+         *        reader; an asynchronous submission beyond it is rejected.
+         * @return This builder.
+         * @throw IllegalArgumentException If capacity is less than 1.
+         * @since 2.6.0
+         */
+        Builder& useReaderCommandQueue(const int capacity);
+
+        /**
+         * Runs the command queues of all the readers on a fixed pool of
+         * worker threads shared by the plugin, instead of a command queue
+         * thread per reader, for hosts serving a large number of readers.
+         *
+         * <p>The workers steal the pending operations from each other, while
+         * the operations of a given reader are still executed one at a time
+         * and in order. The asynchronous card presence waits release their
+         * worker between two checks.
+         *
+         * <p>Implies a command queue per reader, of capacity 64 unless set by
+         * useReaderCommandQueue(int). An operation blocking on another
+         * reader holds its worker meanwhile.
+         *
+         * <p>The card detection of the observed readers is not moved to the
+         * pool: it remains driven by the Keyple core, with a monitoring
+         * thread per observed reader.
+         *
+         * @param threadCount The number of workers, at least 1.
+         * @return This builder.
+         * @throw IllegalArgumentException If threadCount is less than 1.
+         * @since 2.6.0
+         */
+        Builder& useReaderExecutor(const int threadCount);
+
+        /**
+         * Same as useReaderExecutor(int) with one worker per hardware
+         * thread of the host.
+         *
+         * @return This builder.
+         * @since 2.6.0
+         */
+        Builder& useReaderExecutor();
+
+        /**
+         * Loads an ATR identification database used by the plugin to name the
+         * card type behind an ATR (see PcscPlugin::identifyCard).
+         *
+         * <p>The database must follow the "smartcard_list.txt" format of the
+         * pcsc-tools project. It is loaded once, here, into an index allowing
+         * constant time lookups regarding the database size.
+         *
+         * @param path The path of the database file.
+         * @return This builder.
+         * @throw IllegalArgumentException If the path is empty or if the file
+         *        cannot be read.
+         * @since 2.6.0
+         */
+        Builder& useAtrIdentificationDatabase(const std::string& path);
+
+        /**
+         * Persists the capabilities discovered on the readers (firmware
+         * attributes, maximum command size) in the provided file.
+         *
+         * <p>On the next start, the cached capabilities are restored as soon as
+         * a reader is seen and are only checked against the firmware attributes
+         * when a card is first connected, instead of being queried again.
+         *
+         * @param path The path of the cache file, created if needed.
+         * @return This builder.
+         * @throw IllegalArgumentException If the path is empty.
+         * @since 2.6.0
+         */
+        Builder& useReaderCapabilityCache(const std::string& path);
+
         /**
          * Replace the default jnasmartcardio provider by the provider given in
          * argument.
@@ -185,6 +454,11 @@ public:
          */
         std::shared_ptr<Pattern> mContactlessReaderIdentificationFilterPattern;
 
+        /**
+         *
+         */
+        std::shared_ptr<Pattern> mContactReaderIdentificationFilterPattern;
+
         /**
          *
          */
@@ -195,6 +469,82 @@ public:
          */
         int mCardMonitoringCycleDuration;
 
+        /**
+         *
+         */
+        std::shared_ptr<PcscAtrIdentificationIndex> mAtrIdentificationIndex;
+
+        /**
+         *
+         */
+        ContextMode mContextMode;
+
+        /**
+         *
+         */
+        bool mIsLazyInitialization;
+
+        /**
+         *
+         */
+        bool mIsSpeculativeConnection;
+
+        /**
+         *
+         */
+        bool mIsSessionReuse;
+
+        /**
+         *
+         */
+        std::string mPluginName;
+
+        /**
+         *
+         */
+        std::shared_ptr<Pattern> mReaderInclusionFilterPattern;
+
+        /**
+         *
+         */
+        std::shared_ptr<Pattern> mReaderExclusionFilterPattern;
+
+        /**
+         *
+         */
+        std::shared_ptr<PcscReaderCapabilityCache> mReaderCapabilityCache;
+
+        /**
+         *
+         */
+        int mSharedAccessMaxAttempts;
+
+        /**
+         *
+         */
+        int mSharedAccessMaxBackoff;
+
+        /**
+         *
+         */
+        bool mIsCrossProcessAccessLock;
+
+        /**
+         *
+         */
+        int mReaderCommandQueueCapacity;
+
+        /**
+         *
+         */
+        int mReaderExecutorThreadCount;
+
+        /**
+         * Capacity of the command queues implied by the executor or the
+         * speculative connection, unless set.
+         */
+        static const int DEFAULT_READER_COMMAND_QUEUE_CAPACITY;
+
         /**
          * (private)<br>
          *
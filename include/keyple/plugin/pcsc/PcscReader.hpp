@@ -14,12 +14,18 @@
 #pragma once
 
 #include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
 
 #include "keyple/core/common/KeypleReaderExtension.hpp"
 #include "keyple/plugin/pcsc/KeyplePluginPcscExport.hpp"
+#include "keyple/plugin/pcsc/PcscReaderTransaction.hpp"
 
 namespace keyple {
 namespace plugin {
@@ -185,6 +191,121 @@ public:
         EJECT
     };
 
+    /**
+     * Protocol selection policy applied when connecting with
+     * IsoProtocol::ANY to a card offering several protocols.
+     *
+     * <p>The protocols offered by the card are read from its ATR before
+     * connecting.
+     *
+     * @since 2.6.0
+     */
+    enum class ProtocolPreference {
+        /**
+         * Lets the driver choose the protocol (default).
+         *
+         * @since 2.6.0
+         */
+        DRIVER,
+
+        /**
+         * Prefers T=1, which avoids the GET RESPONSE exchange T=0 requires
+         * for each command carrying both data and an expected response.
+         *
+         * @since 2.6.0
+         */
+        T1,
+
+        /**
+         * Prefers T=0.
+         *
+         * @since 2.6.0
+         */
+        T0
+    };
+
+    /**
+     * Statistics of the command queue of a reader (see
+     * PcscPluginFactoryBuilder::Builder::useReaderCommandQueue(int)).
+     *
+     * <p>The times are in microseconds.
+     *
+     * @since 2.6.0
+     */
+    struct CommandQueueStatistics {
+        /**
+         * Number of operations waiting in the queue.
+         *
+         * @since 2.6.0
+         */
+        int depth;
+
+        /**
+         * Number of operations executed.
+         *
+         * @since 2.6.0
+         */
+        uint64_t executedCount;
+
+        /**
+         * Number of operations rejected because the queue was full.
+         *
+         * @since 2.6.0
+         */
+        uint64_t rejectedCount;
+
+        /**
+         * Cumulated time spent by the executed operations in the queue.
+         *
+         * @since 2.6.0
+         */
+        uint64_t totalWaitTime;
+
+        /**
+         * Longest time spent by an operation in the queue.
+         *
+         * @since 2.6.0
+         */
+        uint64_t maxWaitTime;
+    };
+
+    /**
+     * Receives the result of an asynchronous operation returning data.
+     *
+     * <p>Called on the worker thread of the reader, with either the data or
+     * the exception raised by the operation. If the reader is released before
+     * the operation is executed, it is called with an IllegalStateException
+     * by the releasing thread instead.
+     *
+     * @since 2.6.0
+     */
+    using DataCallback = std::function<void(
+        const std::vector<uint8_t>& data, std::exception_ptr error)>;
+
+    /**
+     * Receives the completion of an asynchronous operation.
+     *
+     * <p>Called on the worker thread of the reader, with the exception raised
+     * by the operation if any, null otherwise (see DataCallback for abandoned
+     * operations).
+     *
+     * @since 2.6.0
+     */
+    using CompletionCallback = std::function<void(std::exception_ptr error)>;
+
+    /**
+     * Receives the result of an asynchronous wait for a card insertion or
+     * removal.
+     *
+     * <p>Called on the worker thread of the reader, with true if the expected
+     * event occurred, false if the timeout expired, and the exception raised
+     * if any (see DataCallback for abandoned operations).
+     *
+     * @since 2.6.0
+     */
+    using PresenceCallback
+        = std::function<void(bool isOccurred, std::exception_ptr error)>;
+
     /**
      *
      */
@@ -239,6 +360,9 @@ public:
      * IsoProtocol::ANY to connect using any available protocol (default value
      * IsoProtocol::ANY).
      *
+     * <p>If a card is already connected, the new protocol is negotiated at
+     * once through a warm reset on the existing connection.
+     *
      * @param isoProtocol The {@link IsoProtocol} to use (must be not null).
      * @return This instance.
      * @throw IllegalArgumentException If isoProtocol is null
@@ -246,6 +370,22 @@ public:
      */
     virtual PcscReader& setIsoProtocol(const IsoProtocol& isoProtocol) = 0;
 
+    /**
+     * Changes the protocol selection policy used when the protocol is
+     * IsoProtocol::ANY (default value ProtocolPreference::DRIVER).
+     *
+     * <p>The protocol actually chosen and, when T=1 is preferred over T=0,
+     * the number of GET RESPONSE exchanges avoided are logged.
+     *
+     * <p>It applies to the next connection.
+     *
+     * @param protocolPreference The ProtocolPreference to use.
+     * @return This instance.
+     * @since 2.6.0
+     */
+    virtual PcscReader& setProtocolPreference(
+        const ProtocolPreference protocolPreference) = 0;
+
     /**
      * Changes the action to be taken after disconnection (default value
      * DisconnectionMode::RESET).
@@ -289,6 +429,226 @@ public:
      */
     virtual int getIoctlCcidEscapeCommandId() const = 0;
 
+    /**
+     * Gets the name of the physical device this reader belongs to.
+     *
+     * <p>Multi-slot and dual-interface readers expose one PC/SC reader per slot
+     * (e.g. contactless, contact and SAM slots); all of them share the same
+     * device name, derived from the reader names reported by the platform.
+     *
+     * @return A not empty string.
+     * @since 2.6.0
+     */
+    virtual const std::string& getDeviceName() const = 0;
+
+    /**
+     * Performs a warm reset of the card currently connected, keeping the
+     * connection (SCardReconnect with SCARD_RESET_CARD).
+     *
+     * <p>The duration of the reset is logged.
+     *
+     * @throw IllegalStateException If no card is connected or if the reset has
+     *        failed.
+     * @since 2.6.0
+     */
+    virtual void warmReset() = 0;
+
+    /**
+     * Performs a cold reset (power cycle) of the card currently connected,
+     * keeping the connection (SCardReconnect with SCARD_UNPOWER_CARD).
+     *
+     * <p>The duration of the reset is logged.
+     *
+     * @throw IllegalStateException If no card is connected or if the reset has
+     *        failed.
+     * @since 2.6.0
+     */
+    virtual void coldReset() = 0;
+
+    /**
+     * Gets the features supported by the reader (PC/SC part 10), such as the
+     * secure PIN entry (FEATURE_VERIFY_PIN_DIRECT = 0x06,
+     * FEATURE_MODIFY_PIN_DIRECT = 0x07) or the transparent exchange
+     * (FEATURE_CCID_ESC_COMMAND = 0x13).
+     *
+     * <p>The features are retrieved with the CM_IOCTL_GET_FEATURE_REQUEST
+     * control command the first time this method is called for a reader, and
+     * then cached by the plugin.
+     *
+     * @return A map associating the tag of each feature to the command
+     *         identifier to use with transmitControlCommand(int, const
+     *         std::vector<uint8_t>&), empty if the reader has no feature.
+     * @throw IllegalStateException If the communication with the reader has
+     *        failed.
+     * @since 2.6.0
+     */
+    virtual const std::map<uint8_t, int> getFeatures() = 0;
+
+    /**
+     * Begins a transaction giving the calling thread exclusive access to the
+     * card currently connected, until the returned object is ended or
+     * destroyed.
+     *
+     * <p>Unlike SharingMode::EXCLUSIVE, which holds the card for the whole
+     * physical channel, this allows a multi-APDU sequence to lock the card
+     * once, for exactly one business transaction.
+     *
+     * <p>The timeout applies to the wait for the transactions of the other
+     * threads of the application on this reader; the arbitration between
+     * applications is performed by the PC/SC service.
+     *
+     * <p>During the transaction, the APDUs and control commands transmitted
+     * by the other threads wait for its end, and their asynchronous variants
+     * are rejected.
+     *
+     * @param timeout The maximum time to wait for the transaction, in
+     *        milliseconds.
+     * @return A not null reference.
+     * @throw IllegalStateException If no card is connected, if the timeout
+     *        expired or if the transaction could not be begun.
+     * @since 2.6.0
+     */
+    virtual std::unique_ptr<PcscReaderTransaction> beginTransaction(
+        const int timeout) = 0;
+
+    /**
+     * Gets the names of the readers handled by the plugin belonging to the
+     * same physical device as this reader, this reader included.
+     *
+     * <p>This allows cross-slot workflows (e.g. a card and a SAM on the same
+     * device) to be scheduled together.
+     *
+     * @return A not empty list of reader names.
+     * @since 2.6.0
+     */
+    virtual const std::vector<std::string> getDeviceReaderNames() const = 0;
+
+    /**
+     * Submits the transmission of an APDU to the card to the command queue of
+     * the reader.
+     *
+     * <p>The reader must have been created with a command queue (see
+     * PcscPluginFactoryBuilder::Builder::useReaderCommandQueue(int)); the
+     * physical channel must be open when the command is executed.
+     *
+     * @param apdu The command APDU.
+     * @return The future response APDU; it reports the exceptions of
+     *         ReaderSpi::transmitApdu.
+     * @throw IllegalStateException If the reader has no command queue or if
+     *        the queue is full.
+     * @since 2.6.0
+     */
+    virtual std::future<std::vector<uint8_t>> transmitApduAsync(
+        const std::vector<uint8_t>& apdu) = 0;
+
+    /**
+     * Submits the transmission of an APDU to the card to the command queue of
+     * the reader, the result being delivered to a callback.
+     *
+     * @param apdu The command APDU.
+     * @param callback The callback receiving the response APDU.
+     * @throw IllegalStateException If the reader has no command queue or if
+     *        the queue is full.
+     * @since 2.6.0
+     */
+    virtual void transmitApduAsync(
+        const std::vector<uint8_t>& apdu, const DataCallback& callback) = 0;
+
+    /**
+     * Submits a control command to the command queue of the reader.
+     *
+     * @param commandId The command identifier.
+     * @param command The command data.
+     * @return The future response data.
+     * @throw IllegalStateException If the reader has no command queue or if
+     *        the queue is full.
+     * @since 2.6.0
+     */
+    virtual std::future<std::vector<uint8_t>> transmitControlCommandAsync(
+        const int commandId, const std::vector<uint8_t>& command) = 0;
+
+    /**
+     * Submits a control command to the command queue of the reader, the
+     * result being delivered to a callback.
+     *
+     * @param commandId The command identifier.
+     * @param command The command data.
+     * @param callback The callback receiving the response data.
+     * @throw IllegalStateException If the reader has no command queue or if
+     *        the queue is full.
+     * @since 2.6.0
+     */
+    virtual void transmitControlCommandAsync(
+        const int commandId,
+        const std::vector<uint8_t>& command,
+        const DataCallback& callback) = 0;
+
+    /**
+     * Submits the connection to the card (opening of the physical channel) to
+     * the command queue of the reader.
+     *
+     * @return The future completion.
+     * @throw IllegalStateException If the reader has no command queue or if
+     *        the queue is full.
+     * @since 2.6.0
+     */
+    virtual std::future<void> connectAsync() = 0;
+
+    /**
+     * Submits the connection to the card to the command queue of the reader,
+     * the completion being delivered to a callback.
+     *
+     * @param callback The callback receiving the completion.
+     * @throw IllegalStateException If the reader has no command queue or if
+     *        the queue is full.
+     * @since 2.6.0
+     */
+    virtual void connectAsync(const CompletionCallback& callback) = 0;
+
+    /**
+     * Submits a wait for the presence of a card to the command queue of the
+     * reader, the result being delivered to a callback.
+     *
+     * <p>The card presence is polled by the worker, without holding it
+     * between two polls: the operations submitted afterwards may therefore be
+     * executed before the wait is over.
+     *
+     * @param timeout The maximum waiting time in milliseconds, positive.
+     * @param callback The callback receiving the result.
+     * @throw IllegalArgumentException If timeout is not positive.
+     * @throw IllegalStateException If the reader has no command queue or if
+     *        the queue is full.
+     * @since 2.6.0
+     */
+    virtual void waitForCardPresentAsync(
+        const long timeout, const PresenceCallback& callback) = 0;
+
+    /**
+     * Submits a wait for the removal of the card to the command queue of the
+     * reader, the result being delivered to a callback.
+     *
+     * <p>As for waitForCardPresentAsync(long, const PresenceCallback&), the
+     * operations submitted afterwards may be executed before the wait is
+     * over.
+     *
+     * @param timeout The maximum waiting time in milliseconds, positive.
+     * @param callback The callback receiving the result.
+     * @throw IllegalArgumentException If timeout is not positive.
+     * @throw IllegalStateException If the reader has no command queue or if
+     *        the queue is full.
+     * @since 2.6.0
+     */
+    virtual void waitForCardAbsentAsync(
+        const long timeout, const PresenceCallback& callback) = 0;
+
+    /**
+     * Gets the statistics of the command queue of the reader.
+     *
+     * @return The statistics, all null if the reader has no command queue.
+     * @since 2.6.0
+     */
+    virtual CommandQueueStatistics getCommandQueueStatistics() = 0;
+
     /**
      *
      */
@@ -303,6 +663,12 @@ public:
      *
      */
     friend std::ostream& operator<<(std::ostream& os, const DisconnectionMode dm);
+
+    /**
+     *
+     */
+    friend std::ostream& operator<<(
+        std::ostream& os, const ProtocolPreference pp);
 };
 
 /**
@@ -14,7 +14,13 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <typeinfo>
 
 #include "keyple/core/plugin/spi/reader/ConfigurableReaderSpi.hpp"
@@ -25,6 +31,8 @@
 #include "keyple/core/util/cpp/Logger.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
 #include "keyple/plugin/pcsc/PcscReader.hpp"
+#include "keyple/plugin/pcsc/PcscReaderCommandQueue.hpp"
+#include "keyple/plugin/pcsc/PcscReaderTransactionAdapter.hpp"
 #include "keyple/plugin/pcsc/cpp/Card.hpp"
 #include "keyple/plugin/pcsc/cpp/CardChannel.hpp"
 #include "keyple/plugin/pcsc/cpp/CardTerminal.hpp"
@@ -277,6 +285,14 @@ public:
     PcscReader&
     setDisconnectionMode(const DisconnectionMode disconnectionMode) final;
 
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    PcscReader&
+    setProtocolPreference(const ProtocolPreference protocolPreference) final;
+
     /**
      * {@inheritDoc}
      *
@@ -294,16 +310,223 @@ public:
     int
     getIoctlCcidEscapeCommandId() const override;
 
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    const std::string& getDeviceName() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    const std::vector<std::string> getDeviceReaderNames() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    std::future<std::vector<uint8_t>> transmitApduAsync(
+        const std::vector<uint8_t>& apdu) override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    void transmitApduAsync(
+        const std::vector<uint8_t>& apdu, const DataCallback& callback) override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    std::future<std::vector<uint8_t>> transmitControlCommandAsync(
+        const int commandId, const std::vector<uint8_t>& command) override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    void transmitControlCommandAsync(
+        const int commandId,
+        const std::vector<uint8_t>& command,
+        const DataCallback& callback) override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    std::future<void> connectAsync() override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    void connectAsync(const CompletionCallback& callback) override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    void waitForCardPresentAsync(
+        const long timeout, const PresenceCallback& callback) override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    void waitForCardAbsentAsync(
+        const long timeout, const PresenceCallback& callback) override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    CommandQueueStatistics getCommandQueueStatistics() override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    void warmReset() override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    void coldReset() override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    const std::map<uint8_t, int> getFeatures() override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    std::unique_ptr<PcscReaderTransaction> beginTransaction(
+        const int timeout) override;
+
+    /**
+     * Releases the direct connection kept open for the control commands, if
+     * any, logging the number of connections it saved.
+     *
+     * <p>Called when the reader is removed or the plugin unregistered.
+     *
+     * @since 2.6.0
+     */
+    void
+    releaseDirectConnection();
+
+    /**
+     * Gets the terminal of the reader.
+     *
+     * @return A not null reference.
+     * @since 2.6.0
+     */
+    const std::shared_ptr<CardTerminal>& getTerminal() const;
+
 private:
+    /**
+     * States of the reader, driving the accesses to the card connection.
+     *
+     * <p>mCard and mChannel are only modified in the CONNECTING and REMOVING
+     * states, and only used in the PROCESSING state, so that a card handle is
+     * never released while a command is in progress on it.
+     */
+    enum class State {
+        /** No card connected nor known in the reader */
+        IDLE,
+        /** Card inserted, not connected */
+        PRESENT,
+        /** Connection being established (transient) */
+        CONNECTING,
+        /** Card connected, no command in progress */
+        CONNECTED,
+        /** Command in progress on the connected card (transient) */
+        PROCESSING,
+        /** Connection being released (transient) */
+        REMOVING
+    };
+
+    /**
+     * Leaves a transient state when going out of scope, back to the stable
+     * state provided at construction unless another one has been set, and
+     * wakes up the threads waiting for the reader, if any.
+     */
+    class StateGuard {
+    public:
+        StateGuard(const PcscReaderAdapter& reader, const State next)
+        : mReader(reader), mNext(next)
+        {
+        }
+
+        StateGuard(const StateGuard&) = delete;
+        StateGuard& operator=(const StateGuard&) = delete;
+
+        ~StateGuard()
+        {
+            mReader.mState.store(mNext);
+
+            /* Locked only to wake up a waiter, the mutex is off the fast path */
+            if (mReader.mStateWaiterCount.load() > 0) {
+                std::lock_guard<std::mutex> lock(mReader.mStateMutex);
+                mReader.mStateChanged.notify_all();
+            }
+        }
+
+        void
+        setNext(const State next)
+        {
+            mNext = next;
+        }
+
+    private:
+        const PcscReaderAdapter& mReader;
+        State mNext;
+    };
+
     /**
      * C++ specific
      */
     bool mIsInitialized;
 
     /**
-     * C++ specific
+     * Changed by compare-and-swap.
+     */
+    mutable std::atomic<State> mState;
+
+    /**
+     * Only used by the threads waiting for the end of a transient state.
      */
-    bool mIsPhysicalChannelOpen;
+    mutable std::mutex mStateMutex;
+
+    /**
+     * Number of threads waiting on mStateChanged.
+     */
+    mutable std::atomic<int> mStateWaiterCount;
+
+    /**
+     * Notified each time a transient state is left.
+     */
+    mutable std::condition_variable mStateChanged;
 
     /**
      *
@@ -320,6 +543,11 @@ private:
      */
     const std::string mName;
 
+    /**
+     *
+     */
+    const std::string mDeviceName;
+
     /**
      *
      */
@@ -360,10 +588,32 @@ private:
      */
     std::string mProtocol;
 
+    /**
+     * Share mode resolved from mProtocol, to spare the parsing on each
+     * connection.
+     */
+    DWORD mShareMode;
+
+    /**
+     * Preferred protocols resolved from mProtocol.
+     */
+    DWORD mPreferredProtocols;
+
+    /**
+     * False if mProtocol has no PC/SC equivalent (e.g. T=CL), the connection
+     * then being rejected by CardTerminal::connect(const std::string&).
+     */
+    bool mIsProtocolResolved;
+
     /**
      *
      */
-    bool mIsModeExclusive;
+    ProtocolPreference mProtocolPreference;
+
+    /**
+     *
+     */
+    std::atomic<bool> mIsModeExclusive;
 
     /**
      *
@@ -383,7 +633,205 @@ private:
     /**
      *
      */
-    bool mIsObservationActive;
+    std::atomic<bool> mIsObservationActive;
+
+    /**
+     * Connection started when the card insertion was detected, consumed by
+     * openPhysicalChannel().
+     */
+    std::future<std::shared_ptr<Card>> mSpeculativeCard;
+
+    /**
+     * Time of the latest card insertion (steady clock, in nanoseconds), zero
+     * once the first response to this card has been received.
+     */
+    std::atomic<int64_t> mCardInsertionTime;
+
+    /**
+     * Connection kept at the end of the previous session, in session reuse
+     * mode.
+     */
+    std::shared_ptr<Card> mParkedCard;
+
+    /**
+     * Card event counter of the reader when the connection was kept.
+     */
+    DWORD mParkedCardEventCount;
+
+    /**
+     * Direct connection to the reader used for the control commands sent
+     * while no card is connected, opened on first use.
+     */
+    std::shared_ptr<Card> mDirectCard;
+
+    /**
+     * Protects the direct connection, control commands may be sent by any
+     * thread.
+     */
+    std::mutex mDirectCardMutex;
+
+    /**
+     * Number of control commands sent over the direct connection without
+     * connecting to the reader.
+     */
+    uint64_t mDirectCardReuseCount;
+
+    /**
+     * Returns the direct connection, opening it if needed.
+     *
+     * @param isReused Set to true if the connection was already open.
+     * @return A not null reference.
+     * @throw CardException If the connection could not be established.
+     */
+    std::shared_ptr<Card>
+    getDirectCard(bool& isReused);
+
+    /**
+     * Releases the direct connection, the mutex must be held by the caller.
+     */
+    void
+    releaseDirectCard();
+
+    /**
+     * Command identifier of CM_IOCTL_GET_FEATURE_REQUEST (PC/SC part 10).
+     */
+    static const int CM_IOCTL_GET_FEATURE_REQUEST_COMMAND_ID;
+
+    /**
+     * Serializes the transactions begun by the threads of the application.
+     */
+    const std::shared_ptr<PcscReaderTransactionAdapter::Lock> mTransactionLock;
+
+    /**
+     * Waits for the end of the transaction of another thread, if any.
+     *
+     * <p>Not needed on the worker of the command queue, the calling thread
+     * having been checked before the command was queued. The lock is not
+     * held during the command: a transaction begun meanwhile waits for it in
+     * acquireState.
+     */
+    void
+    waitForTransaction();
+
+    /**
+     * Ends the PC/SC transaction begun on the card, in the PROCESSING state,
+     * unless the card has been disconnected or reconnected meanwhile, which
+     * has already ended it.
+     *
+     * @param card The card the transaction was begun on.
+     * @param binding The connection of the card the transaction was begun on.
+     * @throw IllegalStateException If the transaction could not be ended.
+     */
+    void
+    endTransaction(const std::shared_ptr<Card> card, const uint64_t binding);
+
+    /**
+     * Checks that no transaction is owned by another thread, before queuing
+     * an asynchronous command.
+     *
+     * @throw IllegalStateException If a transaction of another thread is in
+     *        progress.
+     */
+    void
+    checkTransactionOwnership() const;
+
+    /**
+     * Worker executing the card and reader operations, null if the reader
+     * is driven by the threads of the caller. Declared last so that it is
+     * stopped before the other members are destroyed.
+     */
+    std::unique_ptr<PcscReaderCommandQueue> mCommandQueue;
+
+    /**
+     * Returns the command queue.
+     *
+     * @return A not null reference.
+     * @throw IllegalStateException If the reader has no command queue.
+     */
+    PcscReaderCommandQueue& getCommandQueue();
+
+    /**
+     * Submits a wait for the provided card presence state.
+     *
+     * @param isPresent The expected state.
+     * @param timeout The maximum waiting time in milliseconds.
+     * @param callback The callback receiving the result.
+     */
+    void waitForCardPresenceAsync(
+        const bool isPresent,
+        const long timeout,
+        const PresenceCallback& callback);
+
+    /**
+     * Checks the card presence once, on the worker of the command queue, and
+     * queues the next check unless the expected state or the deadline is
+     * reached, in which case the callback is invoked.
+     *
+     * @param isPresent True to wait for a card, false for its removal.
+     * @param deadline The end of the wait.
+     * @param callback The callback receiving the result.
+     */
+    void pollCardPresence(
+        const bool isPresent,
+        const std::chrono::steady_clock::time_point deadline,
+        const PresenceCallback& callback);
+
+    /**
+     * Converts a control code returned by the reader into the command
+     * identifier expected by transmitControlCommand().
+     */
+    int
+    getCommandId(const uint32_t controlCode) const;
+
+    /**
+     * Waits for the end of the transition or command in progress, if any,
+     * then moves the reader to the provided transient state.
+     *
+     * <p>The state is changed by compare-and-swap. The caller only blocks, on
+     * mStateChanged, while the reader is in a transient state, and owns the
+     * connection once the state is changed, until it restores a stable state
+     * (see StateGuard).
+     *
+     * @param target The transient state to enter.
+     * @param isConnectedRequired If true, the state is only changed if a card
+     *        is connected.
+     * @return The stable state left, or the state found if a connected card
+     *         was required and none was.
+     */
+    State
+    acquireState(const State target, const bool isConnectedRequired) const;
+
+    /**
+     * Keeps the current connection for the next session, or disconnects if
+     * the card is no longer present.
+     *
+     * <p>The reader must be in the REMOVING state.
+     */
+    void
+    parkCard();
+
+    /**
+     * Returns the connection kept at the end of the previous session if the
+     * card was not removed since, releases it otherwise.
+     *
+     * @return Null if no connection can be reused.
+     */
+    std::shared_ptr<Card>
+    takeParkedCard();
+
+    /**
+     * Starts connecting to the card just inserted, if enabled.
+     */
+    void
+    startSpeculativeConnection();
+
+    /**
+     * Waits for the speculative connection, if any, and returns its card.
+     *
+     * @return Null if no speculative connection was started or if it failed.
+     */
+    std::shared_ptr<Card>
+    takeSpeculativeCard();
 
 
     /**
@@ -402,11 +850,10 @@ private:
     * Disconnects the current card and resets the context and reader state.
     *
     * <p>This method handles the disconnection of a card, taking into account
-    * the specific disconnection mode. If the card is an instance of JnaCard, it
-    * disconnects using the extended mode specified by
-    * getDisposition(DisconnectionMode)} and resets the reader state to avoid
-    * incorrect card detection in subsequent operations. For other card types,
-    * it disconnects using the specified disconnection mode directly.
+    * the specific disconnection mode. It disconnects using the mode specified
+    * by getDisposition(DisconnectionMode), except in UNPOWER mode where the
+    * reader state is reset (see resetReaderState()) to avoid incorrect card
+    * detection in subsequent operations.
     *
     * <p>If a CardException occurs during the operation, a ReaderIOException is
     * thrown with the associated error message.
@@ -414,10 +861,22 @@ private:
     * <p>Once the disconnection is handled, the method ensures that the context
     * is reset.
     *
+    * <p>The reader must be in the REMOVING state.
+    *
     * @throw ReaderIOException If an error occurs while closing the physical
     * channel.
     */
     void
+    disconnectCard();
+
+    /**
+     * Disconnects the current card once the commands in progress are
+     * completed, leaving the reader in the IDLE state.
+     *
+     * @throw ReaderIOException If an error occurs while closing the physical
+     * channel.
+     */
+    void
     disconnect();
 
     /**
@@ -426,20 +885,75 @@ private:
      * @param mode The disconnection mode.
      * @return The corresponding SCARD_* value.
      */
-    static int getDisposition(const DisconnectionMode mode);
+    static DWORD getDisposition(const DisconnectionMode mode);
 
     /**
-    * Resets the state of the card reader.
+     * Resolves mProtocol into the PC/SC connection parameters.
+     */
+    void resolveProtocol();
+
+    /**
+     * Connects the card with the resolved connection parameters.
+     *
+     * @param terminal The terminal to connect.
+     * @param protocol The protocol specification.
+     * @param isResolved Whether the following parameters are valid.
+     * @param shareMode The resolved share mode.
+     * @param preferredProtocols The resolved preferred protocols.
+     * @param preference The protocol selection policy, applied when any
+     *        protocol is accepted.
+     * @return A not null reference.
+     * @throw CardException If the connection failed.
+     */
+    static std::shared_ptr<Card> connect(
+        const std::shared_ptr<CardTerminal>& terminal,
+        const std::string& protocol,
+        const bool isResolved,
+        const DWORD shareMode,
+        const DWORD preferredProtocols,
+        const ProtocolPreference preference);
+
+    /**
+     * Gets the protocols offered by a card from its ATR (TDi and TA2
+     * interface bytes).
+     *
+     * @param atr The ATR.
+     * @param defaultProtocol Receives the protocol the card uses by default
+     *        (SCARD_PROTOCOL_T0 or SCARD_PROTOCOL_T1).
+     * @return The offered protocols, as SCARD_PROTOCOL_* flags.
+     */
+    static DWORD getOfferedProtocols(
+        const std::vector<uint8_t>& atr, DWORD& defaultProtocol);
+
+    /**
+     * Logs the GET RESPONSE exchanges of the current connection, and those
+     * avoided by the protocol selection policy.
+     */
+    void logProtocolUsage() const;
+
+    /**
+    * Resets the state of the card reader and releases the card.
     *
-    * <p>This method attempts to reset the reader state based on the current
-    * disconnection mode. If the disconnection mode is set to UNPOWER, it
-    * reconnects to the terminal and then disconnects without powering off the
-    * reader. If any {@link CardException} occurs during this process, it is
+    * <p>The card is power cycled on the existing handle (SCardReconnect) and
+    * then left as is, which puts the reader in the same state as unpowering
+    * the card and connecting to it again, without establishing a new
+    * connection. If any CardException occurs during the power cycle, it is
     * handled silently.
     */
     void
     resetReaderState();
 
+    /**
+     * Resets the card currently connected on the existing handle.
+     *
+     * @param initialization SCARD_RESET_CARD or SCARD_UNPOWER_CARD.
+     * @param type The type of reset, for logging purposes.
+     * @throw IllegalStateException If no card is connected or if the reset
+     *        has failed.
+     */
+    void
+    resetCard(const DWORD initialization, const std::string& type);
+
     /**
      *
      */
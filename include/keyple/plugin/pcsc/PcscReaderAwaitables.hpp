@@ -0,0 +1,243 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+/*
+ * Awaitable reader operations for C++20 coroutines.
+ *
+ * Header only, and empty unless the compiler provides coroutines, so that the
+ * library itself keeps building in C++11.
+ */
+#if defined(__has_include)
+#if __has_include(<coroutine>) && __cplusplus >= 202002L
+#define KEYPLE_PLUGIN_PCSC_COROUTINES 1
+#endif
+#endif
+
+#if defined(KEYPLE_PLUGIN_PCSC_COROUTINES)
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "keyple/plugin/pcsc/PcscReader.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+/**
+ * Awaitable result of an asynchronous reader operation.
+ *
+ * <p>The operation is submitted to the command queue of the reader when the
+ * coroutine is suspended, and the coroutine is resumed directly on the worker
+ * thread of the reader completing it, without any further thread hop. The
+ * reader must therefore have a command queue (see
+ * PcscPluginFactoryBuilder::Builder::useReaderCommandQueue(int)).
+ *
+ * <p>The exceptions raised by the operation, or by its submission, are
+ * rethrown in the coroutine. In particular, awaiting an operation while the
+ * coroutine holds a PcscReaderTransaction rejects the operations awaited
+ * after the first one, the coroutine then running on another thread than the
+ * owner of the transaction.
+ *
+ * @param T The type of the result.
+ * @since 2.6.0
+ */
+template <typename T>
+class PcscReaderAwaitable {
+public:
+    /**
+     * Receives the result of the operation.
+     *
+     * @since 2.6.0
+     */
+    using Callback = std::function<void(T result, std::exception_ptr error)>;
+
+    /**
+     * Starts the operation, with the callback to notify on completion.
+     *
+     * @since 2.6.0
+     */
+    using Starter = std::function<void(const Callback& callback)>;
+
+    /**
+     * Constructor.
+     *
+     * @param starter Submits the operation.
+     * @since 2.6.0
+     */
+    explicit PcscReaderAwaitable(Starter starter)
+    : mStarter(std::move(starter))
+    {
+    }
+
+    /**
+     * The operation always completes asynchronously.
+     *
+     * @since 2.6.0
+     */
+    bool
+    await_ready() const noexcept
+    {
+        return false;
+    }
+
+    /**
+     * Submits the operation.
+     *
+     * @since 2.6.0
+     */
+    void
+    await_suspend(std::coroutine_handle<> handle)
+    {
+        /*
+         * The coroutine may be resumed, and this object destroyed, before the
+         * starter returns: nothing of this object is used afterwards.
+         */
+        const Starter starter = std::move(mStarter);
+
+        starter([this, handle](T result, std::exception_ptr error) {
+            mResult = std::move(result);
+            mError = error;
+            handle.resume();
+        });
+    }
+
+    /**
+     * Returns the result of the operation.
+     *
+     * @throw Any exception raised by the operation.
+     * @since 2.6.0
+     */
+    T
+    await_resume()
+    {
+        if (mError) {
+            std::rethrow_exception(mError);
+        }
+
+        return std::move(mResult);
+    }
+
+private:
+    /**
+     *
+     */
+    Starter mStarter;
+
+    /**
+     *
+     */
+    T mResult{};
+
+    /**
+     *
+     */
+    std::exception_ptr mError;
+};
+
+/**
+ * Transmits an APDU to the card.
+ *
+ * @param reader The reader, with a command queue.
+ * @param apdu The command APDU.
+ * @return An awaitable response APDU.
+ * @since 2.6.0
+ */
+inline PcscReaderAwaitable<std::vector<uint8_t>>
+transmitApduAwaitable(PcscReader& reader, std::vector<uint8_t> apdu)
+{
+    return PcscReaderAwaitable<std::vector<uint8_t>>(
+        [&reader, apdu = std::move(apdu)](
+            const PcscReaderAwaitable<std::vector<uint8_t>>::Callback&
+                callback) {
+            reader.transmitApduAsync(
+                apdu,
+                [callback](
+                    const std::vector<uint8_t>& response,
+                    std::exception_ptr error) { callback(response, error); });
+        });
+}
+
+/**
+ * Transmits a control command to the reader.
+ *
+ * @param reader The reader, with a command queue.
+ * @param commandId The command identifier.
+ * @param command The command data.
+ * @return An awaitable response.
+ * @since 2.6.0
+ */
+inline PcscReaderAwaitable<std::vector<uint8_t>>
+transmitControlCommandAwaitable(
+    PcscReader& reader, const int commandId, std::vector<uint8_t> command)
+{
+    return PcscReaderAwaitable<std::vector<uint8_t>>(
+        [&reader, commandId, command = std::move(command)](
+            const PcscReaderAwaitable<std::vector<uint8_t>>::Callback&
+                callback) {
+            reader.transmitControlCommandAsync(
+                commandId,
+                command,
+                [callback](
+                    const std::vector<uint8_t>& response,
+                    std::exception_ptr error) { callback(response, error); });
+        });
+}
+
+/**
+ * Waits for the insertion of a card.
+ *
+ * @param reader The reader, with a command queue.
+ * @param timeout The maximum waiting time in milliseconds, positive.
+ * @return An awaitable true if a card is present, false if the timeout
+ *         expired.
+ * @since 2.6.0
+ */
+inline PcscReaderAwaitable<bool>
+cardInsertionAwaitable(PcscReader& reader, const long timeout)
+{
+    return PcscReaderAwaitable<bool>(
+        [&reader, timeout](const PcscReaderAwaitable<bool>::Callback& callback) {
+            reader.waitForCardPresentAsync(timeout, callback);
+        });
+}
+
+/**
+ * Waits for the removal of the card.
+ *
+ * @param reader The reader, with a command queue.
+ * @param timeout The maximum waiting time in milliseconds, positive.
+ * @return An awaitable true if the card has been removed, false if the
+ *         timeout expired.
+ * @since 2.6.0
+ */
+inline PcscReaderAwaitable<bool>
+cardRemovalAwaitable(PcscReader& reader, const long timeout)
+{
+    return PcscReaderAwaitable<bool>(
+        [&reader, timeout](const PcscReaderAwaitable<bool>::Callback& callback) {
+            reader.waitForCardAbsentAsync(timeout, callback);
+        });
+}
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
+
+#endif /* KEYPLE_PLUGIN_PCSC_COROUTINES */
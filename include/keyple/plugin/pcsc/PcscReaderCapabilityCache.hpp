@@ -0,0 +1,131 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "keyple/core/util/cpp/Logger.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
+#include "keyple/plugin/pcsc/PcscReaderProfile.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
+
+/**
+ * (package-private)<br>
+ * Persistent cache of the reader capabilities, stored in a text file.
+ *
+ * <p>Each line of the file describes a reader, the fields being separated by
+ * tabulations: reader name, firmware attributes (hexadecimal), maximum
+ * command size and features (hexadecimal TLV list, "-" if the reader has
+ * none, "?" if unknown). Lines starting with '#' are ignored.
+ *
+ * <p>The file is read once when the cache is created and rewritten each time
+ * a reader profile is added or changes.
+ *
+ * @since 2.6.0
+ */
+class PcscReaderCapabilityCache final {
+public:
+    /**
+     * Creates a cache backed by the provided file, loading its content if it
+     * exists.
+     *
+     * @param path The path of the cache file.
+     * @since 2.6.0
+     */
+    explicit PcscReaderCapabilityCache(const std::string& path);
+
+    /**
+     * Restores into the provided profile the capabilities cached for its
+     * reader, if any.
+     *
+     * @param profile The profile to complete.
+     * @return True if an entry was found for the reader.
+     * @since 2.6.0
+     */
+    bool restore(PcscReaderProfile& profile) const;
+
+    /**
+     * Stores the capabilities of the provided profile, rewriting the file if
+     * they differ from the cached ones.
+     *
+     * @param profile The profile to store.
+     * @since 2.6.0
+     */
+    void store(const PcscReaderProfile& profile);
+
+private:
+    /**
+     *
+     */
+    struct Entry {
+        std::string mFirmwareVersion;
+        int mMaxInputSize;
+        std::string mFeatures;
+    };
+
+    /**
+     *
+     */
+    static const std::string UNKNOWN_FEATURES;
+
+    /**
+     *
+     */
+    static const std::string NO_FEATURES;
+
+    /**
+     *
+     */
+    const std::unique_ptr<Logger> mLogger =
+        LoggerFactory::getLogger(typeid(PcscReaderCapabilityCache));
+
+    /**
+     *
+     */
+    const std::string mPath;
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+
+    /**
+     *
+     */
+    std::map<std::string, Entry> mEntries;
+
+    /**
+     *
+     */
+    void load();
+
+    /**
+     * Writes the cache file, the mutex must be held by the caller.
+     */
+    void save() const;
+};
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,327 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "keyple/core/util/cpp/Logger.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
+#include "keyple/plugin/pcsc/PcscReader.hpp"
+#include "keyple/plugin/pcsc/PcscReaderExecutor.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
+
+/**
+ * (package-private)<br>
+ * Bounded queue of the operations of a reader, executed in order by a worker
+ * thread owned by the reader, or by the workers of an executor shared by all
+ * the readers.
+ *
+ * <p>All the card and reader operations then run on the worker, the threads
+ * of the application only submitting them.
+ *
+ * <p>On a shared executor, the queue has at most one task in the pool at a
+ * time, draining a few operations before yielding the worker, so that the
+ * operations of a reader keep their order whatever the worker running them.
+ *
+ * @since 2.6.0
+ */
+class PcscReaderCommandQueue final {
+public:
+    /**
+     * Creates the queue and starts its worker.
+     *
+     * @param readerName The name of the reader, for logging.
+     * @param capacity The maximum number of pending operations.
+     * @param executor The executor running the operations, null to give the
+     *        queue its own worker thread.
+     * @since 2.6.0
+     */
+    PcscReaderCommandQueue(
+        const std::string& readerName,
+        const int capacity,
+        const std::shared_ptr<PcscReaderExecutor> executor);
+
+    /**
+     * Stops the worker; the operations still pending are abandoned, their
+     * futures reporting a broken promise and their abandonment handlers, if
+     * any, being invoked.
+     *
+     * <p>Waits for the operation in progress, if any, unless called from one
+     * of the operations of the queue, in which case its worker is released
+     * once the operation returns, without touching the queue any more.
+     *
+     * @since 2.6.0
+     */
+    ~PcscReaderCommandQueue();
+
+    /**
+     * Submits an operation.
+     *
+     * @param operation The operation.
+     * @param isBlocking True to wait for room in the queue, false to fail at
+     *        once if the queue is full.
+     * @return The future result of the operation.
+     * @throw IllegalStateException If the queue is full and isBlocking is
+     *        false.
+     * @since 2.6.0
+     */
+    template <typename T>
+    std::future<T>
+    submit(const std::function<T()>& operation, const bool isBlocking)
+    {
+        const auto task = std::make_shared<std::packaged_task<T()>>(operation);
+        std::future<T> result = task->get_future();
+
+        post([task]() { (*task)(); }, nullptr, isBlocking);
+
+        return result;
+    }
+
+    /**
+     * Executes an operation on the worker and waits for its result, or
+     * executes it at once when called from the worker itself.
+     *
+     * @param operation The operation.
+     * @return The result of the operation.
+     * @throw Any exception thrown by the operation.
+     * @since 2.6.0
+     */
+    template <typename T>
+    T
+    call(const std::function<T()>& operation)
+    {
+        if (isWorkerThread()) {
+            return operation();
+        }
+
+        return submit(operation, true).get();
+    }
+
+    /**
+     * Submits an operation reporting its result through a callback.
+     *
+     * @param operation The operation.
+     * @param abandonment Invoked instead of the operation if the queue is
+     *        stopped before executing it, to complete the callback with an
+     *        error.
+     * @param isBlocking True to wait for room in the queue, false to fail at
+     *        once if the queue is full.
+     * @throw IllegalStateException If the queue is stopped, or full and
+     *        isBlocking is false.
+     * @since 2.6.0
+     */
+    void execute(
+        const std::function<void()>& operation,
+        const std::function<void()>& abandonment,
+        const bool isBlocking);
+
+    /**
+     * Queues the continuation of the operation in progress, to be executed
+     * once the provided delay has elapsed.
+     *
+     * <p>A continuation is not subject to the capacity of the queue. The
+     * worker is released during the delay, the other operations of the queue
+     * being executed meanwhile.
+     *
+     * @param operation The operation.
+     * @param delay The delay in milliseconds.
+     * @param abandonment Invoked instead of the operation if the queue is
+     *        stopped before executing it.
+     * @since 2.6.0
+     */
+    void postDelayed(
+        const std::function<void()>& operation,
+        const long delay,
+        const std::function<void()>& abandonment);
+
+    /**
+     * Indicates whether the calling thread is the worker of this queue.
+     *
+     * @return True if called from the worker.
+     * @since 2.6.0
+     */
+    bool isWorkerThread() const;
+
+    /**
+     * Gets the statistics of the queue.
+     *
+     * @return The statistics.
+     * @since 2.6.0
+     */
+    PcscReader::CommandQueueStatistics getStatistics();
+
+private:
+    /**
+     *
+     */
+    struct Entry {
+        std::function<void()> mOperation;
+        std::function<void()> mAbandonment;
+        std::chrono::steady_clock::time_point mSubmissionTime;
+    };
+
+    /**
+     *
+     */
+    const std::unique_ptr<Logger> mLogger =
+        LoggerFactory::getLogger(typeid(PcscReaderCommandQueue));
+
+    /**
+     *
+     */
+    const std::string mReaderName;
+
+    /**
+     *
+     */
+    const size_t mCapacity;
+
+    /**
+     *
+     */
+    std::mutex mMutex;
+
+    /**
+     * Signaled when an operation is queued or the queue stopped.
+     */
+    std::condition_variable mNotEmpty;
+
+    /**
+     * Signaled when an operation is taken from the queue.
+     */
+    std::condition_variable mNotFull;
+
+    /**
+     *
+     */
+    std::deque<Entry> mEntries;
+
+    /**
+     * Continuations waiting for their due time, when the queue has its own
+     * worker thread.
+     */
+    std::multimap<std::chrono::steady_clock::time_point, Entry> mDelayedEntries;
+
+    /**
+     *
+     */
+    bool mIsStopped;
+
+    /**
+     *
+     */
+    PcscReader::CommandQueueStatistics mStatistics;
+
+    /**
+     * Null if the queue has its own worker thread.
+     */
+    const std::shared_ptr<PcscReaderExecutor> mExecutor;
+
+    /**
+     * True while a task draining the queue is in the executor.
+     */
+    bool mIsScheduled;
+
+    /**
+     * Signaled when the task draining the queue ends.
+     */
+    std::condition_variable mDrained;
+
+    /**
+     * Held by the delayed continuations while they are queued, so that the
+     * destruction waits for them; read and reset under mMutex.
+     */
+    std::shared_ptr<int> mLifetimeToken;
+
+    /**
+     * Set under mMutex once the last reference to mLifetimeToken is released.
+     */
+    bool mIsTokenReleased;
+
+    /**
+     * Signaled when mIsTokenReleased is set.
+     */
+    std::condition_variable mTokenReleased;
+
+    /**
+     *
+     */
+    std::thread mWorker;
+
+    /**
+     * Maximum number of operations executed by a drain task before it yields
+     * the worker of the executor.
+     */
+    static const int DRAIN_BATCH_SIZE;
+
+    /**
+     * Queues an operation.
+     *
+     * @param operation The operation.
+     * @param abandonment Invoked if the operation is abandoned, may be empty.
+     * @param isBlocking True to wait for room in the queue.
+     */
+    void post(
+        const std::function<void()>& operation,
+        const std::function<void()>& abandonment,
+        const bool isBlocking);
+
+    /**
+     * Appends an operation and wakes up the worker; mMutex must be held and
+     * is released.
+     */
+    void push(Entry& entry, std::unique_lock<std::mutex>& lock);
+
+    /**
+     * Moves the continuations whose due time has come to the queue; mMutex
+     * must be held.
+     */
+    void promoteDelayedEntries();
+
+    /**
+     * Takes the first pending operation and updates the statistics; mMutex
+     * must be held and the queue not empty.
+     */
+    void take(Entry& entry);
+
+    /**
+     * Executes the queued operations until the queue is stopped.
+     */
+    void run();
+
+    /**
+     * Executes a batch of queued operations on the executor, then schedules
+     * itself again if operations remain.
+     */
+    void drain();
+};
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+/**
+ * (package-private)<br>
+ * Fixed pool of worker threads shared by the command queues of all the
+ * readers of a plugin.
+ *
+ * <p>Each worker has its own task deque and, once it is empty, steals the
+ * most recently queued tasks of the other workers, so that the load spreads
+ * over the pool without a central queue. The order of the operations of a
+ * reader is kept by its command queue, which has at most one task in the pool
+ * at a time.
+ *
+ * <p>Delayed tasks are kept apart and moved to a worker deque when due, so
+ * that a periodic check does not hold a worker in between.
+ *
+ * @since 2.6.0
+ */
+class PcscReaderExecutor final {
+public:
+    /**
+     * Creates the pool and starts its workers.
+     *
+     * @param threadCount The number of workers, at least 1.
+     * @since 2.6.0
+     */
+    explicit PcscReaderExecutor(const int threadCount);
+
+    /**
+     * Stops the workers; the tasks still pending are abandoned.
+     *
+     * <p>Waits for the tasks in progress. When called from one of the tasks
+     * of the pool, i.e. when a task releases the last reference to the
+     * executor, the calling worker is not waited for and ends once its task
+     * returns.
+     *
+     * @since 2.6.0
+     */
+    ~PcscReaderExecutor();
+
+    /**
+     * Queues a task, on the deque of the calling worker if called from the
+     * pool, on the next worker in turn otherwise.
+     *
+     * @param task The task. Exceptions it throws are logged and dropped.
+     * @since 2.6.0
+     */
+    void execute(const std::function<void()>& task);
+
+    /**
+     * Queues a task once the provided delay has elapsed.
+     *
+     * @param task The task.
+     * @param delay The delay in milliseconds.
+     * @since 2.6.0
+     */
+    void schedule(const std::function<void()>& task, const long delay);
+
+    /**
+     * Gets the number of workers.
+     *
+     * @return A positive number.
+     * @since 2.6.0
+     */
+    int getThreadCount() const;
+
+private:
+    /**
+     * State shared with the workers, which may outlive this object (see the
+     * destructor).
+     */
+    struct Pool;
+
+    /**
+     *
+     */
+    const std::shared_ptr<Pool> mPool;
+
+    /**
+     *
+     */
+    std::vector<std::thread> mThreads;
+};
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,219 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+/**
+ * (package-private)<br>
+ * Set of properties of a PC/SC reader derived from its name and from the
+ * attributes reported by the reader itself.
+ *
+ * <p>Profiles are computed once per reader name by the plugin and shared by
+ * all the PcscReaderAdapter instances created for this name, so that the
+ * identification rules are not re-evaluated each time a reader adapter is
+ * recreated or the readers are listed again.
+ *
+ * <p>The reader capabilities may be restored from the persistent capability
+ * cache at start-up; they are then validated lazily against the firmware
+ * attributes the first time a connection to the reader is available.
+ *
+ * @since 2.6.0
+ */
+class PcscReaderProfile final {
+public:
+    /**
+     * Constructor.
+     *
+     * @param readerName The name of the reader.
+     * @param isContactless True if the reader has been identified as
+     *        contactless.
+     * @since 2.6.0
+     */
+    PcscReaderProfile(const std::string& readerName, const bool isContactless);
+
+    /**
+     * Gets the name of the reader this profile applies to.
+     *
+     * @return A not empty string.
+     * @since 2.6.0
+     */
+    const std::string& getReaderName() const;
+
+    /**
+     * Indicates whether the reader has been identified as contactless by the
+     * contactless reader identification filter.
+     *
+     * @return True if the reader is contactless, false if not.
+     * @since 2.6.0
+     */
+    bool isContactless() const;
+
+    /**
+     * Gets the name of the physical device the reader belongs to, shared by
+     * all the slots of a multi-slot or dual-interface reader.
+     *
+     * @return A not empty string.
+     * @see #getDeviceName(const std::string&)
+     * @since 2.6.0
+     */
+    const std::string& getDeviceName() const;
+
+    /**
+     * Derives the name of the physical device from a reader name.
+     *
+     * <p>pcsc-lite names readers "Device [Interface] (Serial) NN MM", MM
+     * being the slot index: the interface and the slot index are removed.
+     * Windows names readers "Device Interface N", N being the device index:
+     * the usual slot keywords (PICC, SAM, ICC...) are removed.
+     *
+     * @param readerName The name of the reader.
+     * @return A not empty string.
+     * @since 2.6.0
+     */
+    static std::string getDeviceName(const std::string& readerName);
+
+    /**
+     * Gets the firmware attributes of the reader (SCARD_ATTR_VENDOR_IFD_VERSION)
+     * as an hexadecimal string.
+     *
+     * @return An empty string if unknown.
+     * @since 2.6.0
+     */
+    std::string getFirmwareVersion() const;
+
+    /**
+     * Gets the maximum size of a command the reader accepts
+     * (SCARD_ATTR_MAXINPUT).
+     *
+     * @return A negative value if unknown.
+     * @since 2.6.0
+     */
+    int getMaxInputSize() const;
+
+    /**
+     * Indicates whether the capabilities of this profile have been read from
+     * or confirmed by the reader during this session.
+     *
+     * @return True if validated.
+     * @since 2.6.0
+     */
+    bool isValidated() const;
+
+    /**
+     * Indicates whether the features of the reader have been retrieved.
+     *
+     * @return True if the features are known.
+     * @since 2.6.0
+     */
+    bool isFeaturesKnown() const;
+
+    /**
+     * Gets the features of the reader, as returned by the
+     * CM_IOCTL_GET_FEATURE_REQUEST control command (TLV list).
+     *
+     * @return An empty vector if unknown or if the reader has no feature.
+     * @since 2.6.0
+     */
+    std::vector<uint8_t> getFeatures() const;
+
+    /**
+     * Sets the features of the reader.
+     *
+     * @param features The TLV list returned by the reader.
+     * @since 2.6.0
+     */
+    void setFeatures(const std::vector<uint8_t>& features);
+
+    /**
+     * Sets the capabilities restored from the persistent cache, pending
+     * validation.
+     *
+     * @param firmwareVersion The firmware attributes.
+     * @param maxInputSize The maximum command size.
+     * @since 2.6.0
+     */
+    void restore(const std::string& firmwareVersion, const int maxInputSize);
+
+    /**
+     * Sets the capabilities read from the reader and marks the profile as
+     * validated.
+     *
+     * <p>The features are forgotten if the firmware attributes differ from the
+     * known ones.
+     *
+     * @param firmwareVersion The firmware attributes.
+     * @param maxInputSize The maximum command size.
+     * @since 2.6.0
+     */
+    void validate(const std::string& firmwareVersion, const int maxInputSize);
+
+private:
+    /**
+     *
+     */
+    const std::string mReaderName;
+
+    /**
+     *
+     */
+    const bool mIsContactless;
+
+    /**
+     *
+     */
+    const std::string mDeviceName;
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+
+    /**
+     *
+     */
+    std::string mFirmwareVersion;
+
+    /**
+     *
+     */
+    int mMaxInputSize;
+
+    /**
+     *
+     */
+    bool mIsValidated;
+
+    /**
+     *
+     */
+    std::vector<uint8_t> mFeatures;
+
+    /**
+     *
+     */
+    bool mIsFeaturesKnown;
+};
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
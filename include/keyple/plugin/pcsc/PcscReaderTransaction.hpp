@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#pragma once
+
+/* Keyple Plugin Pcsc */
+#include "keyple/plugin/pcsc/KeyplePluginPcscExport.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+/**
+ * Exclusive access to the card of a PC/SC reader, held from its creation by
+ * PcscReader::beginTransaction(int) until it is ended or destroyed.
+ *
+ * <p>All the APDUs exchanged meanwhile with the card are protected from the
+ * other applications by a single PC/SC transaction (SCardBeginTransaction),
+ * instead of being arbitrated one by one by the PC/SC service.
+ *
+ * <p>The transaction is owned by the thread that began it: only the commands
+ * of this thread are part of it. It may be ended or destroyed from any
+ * thread, but before the reader is unregistered.
+ *
+ * <p>As a consequence, a transaction must not span the co_await of an
+ * awaitable operation (see PcscReaderAwaitables.hpp), the coroutine being
+ * resumed on the worker of the reader: end it before awaiting, or use the
+ * synchronous operations during the transaction.
+ *
+ * @since 2.6.0
+ */
+class KEYPLEPLUGINPCSC_API PcscReaderTransaction {
+public:
+    /**
+     * Ends the transaction if it was not ended yet, errors being ignored.
+     *
+     * @since 2.6.0
+     */
+    virtual ~PcscReaderTransaction() = default;
+
+    /**
+     * Ends the transaction, the card being left as is.
+     *
+     * <p>Calling this method on a transaction already ended has no effect.
+     *
+     * @throw IllegalStateException If the PC/SC transaction could not be
+     *        ended properly.
+     * @since 2.6.0
+     */
+    virtual void end() = 0;
+};
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "keyple/core/util/cpp/Logger.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
+#include "keyple/plugin/pcsc/PcscReaderTransaction.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
+
+/**
+ * (package-private)<br>
+ * Implementation of PcscReaderTransaction.
+ *
+ * @since 2.6.0
+ */
+class PcscReaderTransactionAdapter final : public PcscReaderTransaction {
+public:
+    /**
+     * Transaction lock of a reader, held by the thread owning the transaction
+     * in progress.
+     *
+     * <p>Not bound to the thread holding it, unlike a mutex: the transaction
+     * may be ended from any thread.
+     *
+     * @since 2.6.0
+     */
+    struct Lock {
+        /**
+         * Protects the changes of owner, the threads waiting for the lock
+         * being notified by released.
+         */
+        std::mutex mutex;
+        std::condition_variable released;
+
+        /**
+         * Thread owning the transaction, a default id if the lock is free.
+         */
+        std::atomic<std::thread::id> owner;
+    };
+
+    /**
+     * Creates a transaction whose lock is already held by the calling thread.
+     *
+     * @param endExclusive Ends the PC/SC transaction on the card, null if the
+     *        card is already held exclusively by the reader
+     *        (SharingMode::EXCLUSIVE).
+     * @param lock The transaction lock of the reader.
+     * @since 2.6.0
+     */
+    PcscReaderTransactionAdapter(
+        const std::function<void()>& endExclusive,
+        const std::shared_ptr<Lock> lock);
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    ~PcscReaderTransactionAdapter();
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.6.0
+     */
+    void end() override;
+
+private:
+    /**
+     *
+     */
+    const std::unique_ptr<Logger> mLogger =
+        LoggerFactory::getLogger(typeid(PcscReaderTransactionAdapter));
+
+    /**
+     *
+     */
+    const std::function<void()> mEndExclusive;
+
+    /**
+     *
+     */
+    const std::shared_ptr<Lock> mLock;
+
+    /**
+     *
+     */
+    bool mIsEnded;
+
+    /**
+     * Frees the transaction lock and wakes up the threads waiting for it.
+     */
+    void
+    releaseLock();
+};
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,223 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
+#include <winscard.h>
+#else
+#include <PCSC/wintypes.h>
+#include <PCSC/winscard.h>
+#endif
+
+#include "keyple/core/util/cpp/Logger.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+namespace cpp {
+
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
+
+/**
+ * Coordinates the accesses to readers shared with other applications
+ * (SCardConnect in shared mode, SCardBeginTransaction).
+ *
+ * <p>An access refused with SCARD_E_SHARING_VIOLATION is retried a bounded
+ * number of times, with an exponential backoff randomized to prevent the
+ * competing processes from retrying in lockstep.
+ *
+ * <p>Optionally, the accesses to a reader are ordered across the processes
+ * of the host by a ticket lock held in POSIX shared memory: the processes are
+ * served in the order of their requests instead of racing inside the PC/SC
+ * service. A process stalled or dead while holding its ticket is skipped
+ * after a lease period. Not available on Windows, where the lock is ignored.
+ *
+ * <p>The time spent waiting is measured and logged.
+ */
+class AccessCoordinator {
+public:
+    /**
+     * Constructor.
+     *
+     * @param maxAttempts The maximum number of attempts of an access (1 for no
+     *        retry).
+     * @param maxBackoff The maximum delay between two attempts, in
+     *        milliseconds.
+     * @param isCrossProcessLock Whether the accesses are ordered across
+     *        processes.
+     */
+    AccessCoordinator(
+        const int maxAttempts,
+        const int maxBackoff,
+        const bool isCrossProcessLock);
+
+    /**
+     * Destructor, unmaps the shared memory segments.
+     */
+    virtual ~AccessCoordinator();
+
+    /**
+     * Performs an access to a reader according to the policy.
+     *
+     * @param readerName The name of the reader.
+     * @param access The PC/SC operation, returning its error code.
+     * @return The error code of the last attempt.
+     */
+    LONG execute(const std::string& readerName, const std::function<LONG()>& access);
+
+    /**
+     * Returns the number of accesses that had to wait (lock or retry).
+     *
+     * @return A positive or null number.
+     */
+    uint64_t getContendedAccessCount() const;
+
+    /**
+     * Returns the number of accesses still refused after the last attempt.
+     *
+     * @return A positive or null number.
+     */
+    uint64_t getFailedAccessCount() const;
+
+    /**
+     * Returns the cumulated waiting time, in microseconds.
+     *
+     * @return A positive or null number.
+     */
+    uint64_t getTotalWaitTime() const;
+
+    /**
+     * Returns the longest waiting time of an access, in microseconds.
+     *
+     * @return A positive or null number.
+     */
+    uint64_t getMaxWaitTime() const;
+
+private:
+    /**
+     * Ticket lock shared between processes.
+     */
+    struct SharedTicketLock {
+        std::atomic<uint32_t> mNextTicket;
+        std::atomic<uint32_t> mServingTicket;
+    };
+
+    /**
+     *
+     */
+    static const int INITIAL_BACKOFF = 2;
+
+    /**
+     * Period after which a ticket not released is considered abandoned.
+     */
+    static const int TICKET_LEASE = 2000;
+
+    /**
+     *
+     */
+    const std::shared_ptr<Logger> mLogger =
+        LoggerFactory::getLogger(typeid(AccessCoordinator));
+
+    /**
+     *
+     */
+    const int mMaxAttempts;
+
+    /**
+     *
+     */
+    const int mMaxBackoff;
+
+    /**
+     *
+     */
+    const bool mIsCrossProcessLock;
+
+    /**
+     *
+     */
+    std::mutex mMutex;
+
+    /**
+     * Shared memory segments mapped so far, by reader name.
+     */
+    std::map<std::string, SharedTicketLock*> mTicketLocks;
+
+    /**
+     *
+     */
+    std::atomic<uint64_t> mContendedAccessCount;
+
+    /**
+     *
+     */
+    std::atomic<uint64_t> mFailedAccessCount;
+
+    /**
+     *
+     */
+    std::atomic<uint64_t> mTotalWaitTime;
+
+    /**
+     *
+     */
+    std::atomic<uint64_t> mMaxWaitTime;
+
+    /**
+     * Returns the ticket lock of a reader, mapping it on first use.
+     *
+     * @param readerName The name of the reader.
+     * @return Null if the shared memory is not available.
+     */
+    SharedTicketLock* getTicketLock(const std::string& readerName);
+
+    /**
+     * Waits for the turn of a new ticket.
+     *
+     * @param ticketLock The lock.
+     * @return The ticket.
+     */
+    static uint32_t acquire(SharedTicketLock* ticketLock);
+
+    /**
+     * Hands the lock over to the next ticket.
+     *
+     * @param ticketLock The lock.
+     * @param ticket The ticket obtained by acquire().
+     */
+    static void release(SharedTicketLock* ticketLock, const uint32_t ticket);
+
+    /**
+     * Returns the delay before a new attempt, in milliseconds.
+     *
+     * @param attempt The number of the failed attempt, from 1.
+     * @return The delay.
+     */
+    int getBackoff(const int attempt) const;
+};
+
+} /* namespace cpp */
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
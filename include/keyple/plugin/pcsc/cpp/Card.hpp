@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -26,7 +27,7 @@
 #endif
 
 #include "keyple/plugin/pcsc/cpp/CardChannel.hpp"
-#include "keyple/plugin/pcsc/cpp/CardChannel.hpp"
+#include "keyple/plugin/pcsc/cpp/ContextManager.hpp"
 #include "keyple/core/util/cpp/Logger.hpp"
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
 
@@ -54,12 +55,12 @@ public:
     /**
      *
      */
-    const SCARD_IO_REQUEST mIORequest;
+    SCARD_IO_REQUEST mIORequest;
 
     /**
      *
      */
-    const SCARDHANDLE mHandle;
+    SCARDHANDLE mHandle;
 
     /**
      * Constructor.
@@ -69,13 +70,50 @@ public:
         const SCARDHANDLE handle,
         const std::vector<uint8_t> atr,
         const DWORD protocol,
-        const SCARD_IO_REQUEST ioRequest);
+        const SCARD_IO_REQUEST ioRequest,
+        const DWORD shareMode,
+        const DWORD preferredProtocols,
+        const std::shared_ptr<ContextManager> contextManager,
+        const uint64_t contextGeneration);
 
     /**
      * Destructor.
      */
     virtual ~Card() = default;
 
+    /**
+     * Binds this object to a new connection, as if it had just been
+     * constructed, reusing its buffers.
+     *
+     * <p>Used by CardTerminal to recycle the Card of a disconnected
+     * connection instead of allocating a new one on each card insertion.
+     * The channels obtained on the former connection are no longer usable,
+     * except the basic channel when no one else holds it, which is bound to
+     * the new connection.
+     *
+     * @param handle The handle of the new connection.
+     * @param atr The ATR of the card.
+     * @param atrLength The length of the ATR.
+     * @param protocol The active protocol.
+     * @param ioRequest The protocol control information.
+     * @param shareMode The share mode the connection was established with.
+     * @param preferredProtocols The protocols requested on connection.
+     * @param contextManager The context the handle was obtained with.
+     * @param contextGeneration The generation of this context.
+     * @since 2.6.0
+     */
+    void
+    rebind(
+        const SCARDHANDLE handle,
+        const uint8_t* atr,
+        const size_t atrLength,
+        const DWORD protocol,
+        const SCARD_IO_REQUEST ioRequest,
+        const DWORD shareMode,
+        const DWORD preferredProtocols,
+        const std::shared_ptr<ContextManager> contextManager,
+        const uint64_t contextGeneration);
+
     /**
      * Disconnects the connection with this card. After this method returns,
      * calling methods on this object or in CardChannels associated with this
@@ -90,6 +128,55 @@ public:
     void
     disconnect(const bool reset);
 
+    /**
+     * Disconnects the connection with this card using the provided
+     * disposition.
+     *
+     * <p>As for disconnect(bool), a failure is logged and ignored, the handle
+     * being unusable afterwards anyway.
+     *
+     * @param disposition The action to take on the card (SCARD_LEAVE_CARD,
+     *        SCARD_RESET_CARD, SCARD_UNPOWER_CARD or SCARD_EJECT_CARD).
+     * @since 2.6.0
+     */
+    void
+    disconnect(const DWORD disposition);
+
+    /**
+     * Re-establishes the connection with this card on the existing handle
+     * (SCardReconnect), with the share mode and the protocols it was
+     * connected with.
+     *
+     * <p>This is much cheaper than disconnecting and connecting again. The
+     * ATR and the active protocol are updated.
+     *
+     * @param initialization The action to take on the card (SCARD_LEAVE_CARD
+     *        for no reset, SCARD_RESET_CARD for a warm reset or
+     *        SCARD_UNPOWER_CARD for a cold reset).
+     * @throw CardNotPresentException If the card has been removed.
+     * @throw CardException If the card operation failed.
+     * @since 2.6.0
+     */
+    void
+    reconnect(const DWORD initialization);
+
+    /**
+     * Re-establishes the connection with this card on the existing handle
+     * (SCardReconnect), negotiating a protocol among the provided ones.
+     *
+     * @param shareMode The share mode (SCARD_SHARE_*).
+     * @param preferredProtocols The acceptable protocols (SCARD_PROTOCOL_*).
+     * @param initialization The action to take on the card.
+     * @throw CardNotPresentException If the card has been removed.
+     * @throw CardException If the card operation failed.
+     * @since 2.6.0
+     */
+    void
+    reconnect(
+        const DWORD shareMode,
+        const DWORD preferredProtocols,
+        const DWORD initialization);
+
     /**
      * Returns the ATR of this card.
      *
@@ -135,6 +222,8 @@ public:
      * Returns the CardChannel for the basic logical channel. The basic logical
      * channel has a channel number of 0.
      *
+     * <p>The same object is returned on each call.
+     *
      * @throw IllegalStateException If this card object has been disposed of via
      * the disconnect() method
      */
@@ -154,6 +243,51 @@ public:
     transmitControlCommand(
         const int commandId, const std::vector<uint8_t>& command);
 
+    /**
+     * Gets the value of a reader attribute (SCardGetAttrib).
+     *
+     * @param attributeId The identifier of the attribute (SCARD_ATTR_*).
+     * @return The raw value of the attribute.
+     * @throw CardException If the attribute could not be read.
+     * @since 2.6.0
+     */
+    const std::vector<uint8_t>
+    getAttribute(const DWORD attributeId);
+
+    /**
+     * Indicates whether the handle of this card belongs to a former PC/SC
+     * context.
+     *
+     * <p>The handle becomes stale when its context has been re-established,
+     * e.g. after a restart of the PC/SC service. A stale card must be
+     * discarded and a new connection established.
+     *
+     * @return True if the handle is stale.
+     * @since 2.6.0
+     */
+    bool
+    isStale() const;
+
+    /**
+     * Indicates whether disconnect() has been called on the current
+     * connection.
+     *
+     * @return True if this object can be bound to a new connection.
+     * @since 2.6.0
+     */
+    bool
+    isDisconnected() const;
+
+    /**
+     * Identifies the connection this object is currently bound to, changed
+     * by each rebind().
+     *
+     * @return The binding number.
+     * @since 2.6.0
+     */
+    uint64_t
+    getBinding() const;
+
 private:
     /**
      *
@@ -166,10 +300,50 @@ private:
      */
     std::vector<uint8_t> mAtr;
 
+    /**
+     * Receives the responses to the control commands, allocated on first use.
+     */
+    std::vector<uint8_t> mControlResponseBuffer;
+
+    /**
+     *
+     */
+    DWORD mShareMode;
+
+    /**
+     *
+     */
+    DWORD mPreferredProtocols;
+
+    /**
+     * Weak, the terminal keeping a reference to its latest card for reuse.
+     */
+    const std::weak_ptr<CardTerminal> mCardTerminal;
+
+    /**
+     * Context the handle was obtained with.
+     */
+    std::shared_ptr<ContextManager> mContextManager;
+
+    /**
+     * Generation of the PC/SC context the handle was obtained with.
+     */
+    uint64_t mContextGeneration;
+
+    /**
+     * Created on first use, and kept by rebind() unless held elsewhere.
+     */
+    std::shared_ptr<CardChannel> mBasicChannel;
+
+    /**
+     *
+     */
+    std::atomic<bool> mIsDisconnected;
+
     /**
      *
      */
-    const std::shared_ptr<CardTerminal> mCardTerminal;
+    std::atomic<uint64_t> mBinding;
 };
 
 } /* namespace cpp */
@@ -52,7 +52,8 @@ public:
     /**
      * Returns the Card this channel is associated with.
      *
-     * @return The Card this channel is associated with.
+     * @return The Card this channel is associated with, null if the card
+     *         object has been released.
      */
     std::shared_ptr<Card>
     getCard() const;
@@ -90,11 +91,49 @@ public:
      * Transmits the command APDU stored in the command apduIn and receives
      * the response APDU in the response.
      *
+     * <p>The response is the only allocation of a nominal exchange; the
+     * command is copied as well when it has to be modified (6Cxx and 61xx
+     * handling).
+     *
      * @param apduIn C-APDU
      * @return R-APDU in the form of a byte vector.
      */
     std::vector<uint8_t> transmit(const std::vector<uint8_t>& apduIn);
 
+    /**
+     * Binds this channel to a new connection of its card, its counters being
+     * reset.
+     *
+     * <p>Called by Card::rebind when no one else holds the channel.
+     *
+     * @param binding The new connection of the card (see Card::getBinding).
+     * @since 2.6.0
+     */
+    void
+    rebind(const uint64_t binding);
+
+    /**
+     * Returns the number of GET RESPONSE commands issued on 61xx status
+     * words on this channel.
+     *
+     * @return A positive or null number.
+     * @since 2.6.0
+     */
+    uint64_t
+    getGetResponseCount() const;
+
+    /**
+     * Returns the number of commands carrying both data and an expected
+     * response (ISO7816 case 4) transmitted on this channel.
+     *
+     * <p>With T=0, each of these commands requires a GET RESPONSE exchange.
+     *
+     * @return A positive or null number.
+     * @since 2.6.0
+     */
+    uint64_t
+    getCase4CommandCount() const;
+
 private:
     /**
      *
@@ -112,10 +151,25 @@ private:
      */
     bool mIsClosed;
 
+    /**
+     * Weak, the card keeping its basic channel.
+     */
+    std::weak_ptr<Card> mCard;
+
+    /**
+     * Connection of the card this channel belongs to (see Card::getBinding).
+     */
+    uint64_t mBinding;
+
+    /**
+     *
+     */
+    uint64_t mGetResponseCount;
+
     /**
      *
      */
-    std::shared_ptr<Card> mCard;
+    uint64_t mCase4CommandCount;
 };
 
 } /* namespace cpp */
@@ -13,6 +13,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
 #if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
 #include <winscard.h>
 #else
@@ -24,6 +28,7 @@
 #include "keyple/core/util/cpp/LoggerFactory.hpp"
 #include "keyple/plugin/pcsc/KeyplePluginPcscExport.hpp"
 #include "keyple/plugin/pcsc/PcscReader.hpp"
+#include "keyple/plugin/pcsc/cpp/AccessCoordinator.hpp"
 #include "keyple/plugin/pcsc/cpp/Card.hpp"
 
 namespace keyple {
@@ -69,6 +74,58 @@ public:
     bool
     isCardPresent();
 
+    /**
+     * Returns the current state of this terminal as reported by the PC/SC
+     * service (dwEventState): the SCARD_STATE_* flags in the lower 16 bits and
+     * the number of card events (insertions and removals) in the upper 16
+     * bits.
+     *
+     * @return The state of the terminal.
+     * @throw CardException if the status could not be determined.
+     * @since 2.6.0
+     */
+    DWORD
+    getState();
+
+    /**
+     * Returns the current state of this terminal, as getState(), along with
+     * the ATR of the card present, without connecting to it.
+     *
+     * @param atr Receives the ATR, empty if no card is present.
+     * @return The state of the terminal.
+     * @throw CardException if the status could not be determined.
+     * @since 2.6.0
+     */
+    DWORD
+    getState(std::vector<uint8_t>& atr);
+
+    /**
+     * Indicates whether the reader behind this terminal is still the one the
+     * terminal was created for, as of the latest state read, without
+     * querying the PC/SC service.
+     *
+     * <p>A reader unplugged and plugged again keeps its name, but restarts its
+     * card event counter: a counter lower than the one previously read by
+     * this terminal reveals it. Once detached, a terminal remains so, and is
+     * replaced by the next CardTerminals::update.
+     *
+     * @return False if the reader is gone or has been replaced.
+     * @since 2.6.0
+     */
+    bool
+    isAttached() const;
+
+    /**
+     * Takes into account a state of the reader read by SCardGetStatusChange,
+     * whether by this terminal or for all the readers at once.
+     *
+     * @param eventState The dwEventState of the reader.
+     * @return Same as isAttached().
+     * @since 2.6.0
+     */
+    bool
+    trackEventState(const DWORD eventState);
+
     /**
      * Establishes a connection to the card. If a connection has previously
      * established using the specified protocol, this method returns the same
@@ -87,6 +144,46 @@ public:
      */
     std::shared_ptr<Card> connect(const std::string& protocol);
 
+    /**
+     * Establishes a connection to the card with connection parameters
+     * already resolved by getConnectionParameters().
+     *
+     * <p>The Card object of the previous connection is reused once it has
+     * been disconnected, instead of allocating a new one.
+     *
+     * @param shareMode The share mode (SCARD_SHARE_*).
+     * @param preferredProtocols The acceptable protocols (SCARD_PROTOCOL_*).
+     * @throw CardNotPresentException If no card is present in this terminal.
+     * @throw CardException If a connection could not be established.
+     * @since 2.6.0
+     */
+    std::shared_ptr<Card> connect(
+        const DWORD shareMode, const DWORD preferredProtocols);
+
+    /**
+     * Returns the coordinator of the accesses to this terminal.
+     *
+     * @return A not null reference.
+     * @since 2.6.0
+     */
+    std::shared_ptr<AccessCoordinator> getAccessCoordinator();
+
+    /**
+     * Converts a protocol specification, as accepted by connect(), into the
+     * corresponding PC/SC share mode and preferred protocols.
+     *
+     * @param protocol The protocol specification.
+     * @param shareMode Receives the share mode (SCARD_SHARE_*).
+     * @param preferredProtocols Receives the protocols (SCARD_PROTOCOL_*).
+     * @throw IllegalArgumentException if protocol is an invalid protocol
+     * specification.
+     * @since 2.6.0
+     */
+    static void getConnectionParameters(
+        const std::string& protocol,
+        DWORD& shareMode,
+        DWORD& preferredProtocols);
+
     /**
      * Waits until a card is absent in this terminal or the timeout
      * expires. If the method returns due to an expired timeout, it returns
@@ -161,6 +258,32 @@ private:
      *
      */
     const std::shared_ptr<CardTerminals> mCardTerminals;
+
+    /**
+     * Reads the state of this terminal and, if requested, the ATR.
+     */
+    DWORD readState(std::vector<uint8_t>* atr);
+
+    /**
+     * Highest card event counter read so far, -1 before the first read.
+     */
+    std::atomic<int64_t> mEventCount;
+
+    /**
+     * Set once the reader is known to be gone or replaced.
+     */
+    std::atomic<bool> mIsDetached;
+
+    /**
+     * Latest card connected, reused by the next connection once disconnected.
+     */
+    std::shared_ptr<Card> mRecycledCard;
+
+    /**
+     * Protects mRecycledCard, connections being possibly established from
+     * several threads.
+     */
+    std::mutex mRecycledCardMutex;
 };
 
 } /* namespace cpp */
@@ -14,9 +14,17 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "keyple/core/util/cpp/Logger.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
+#include "keyple/plugin/pcsc/cpp/AccessCoordinator.hpp"
 #include "keyple/plugin/pcsc/cpp/CardTerminal.hpp"
+#include "keyple/plugin/pcsc/cpp/ContextManager.hpp"
+#include "keyple/plugin/pcsc/cpp/ContextPool.hpp"
 
 #if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
 #include <winscard.h>
@@ -30,6 +38,9 @@ namespace plugin {
 namespace pcsc {
 namespace cpp {
 
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
+
 /**
  * The set of terminals supported by a TerminalFactory.
  * This class allows applications to enumerate the available CardTerminals,
@@ -38,11 +49,6 @@ namespace cpp {
  */
 class CardTerminals : public std::enable_shared_from_this<CardTerminals> {
 public:
-    /**
-     *
-     */
-    SCARDCONTEXT& mContext;
-
     /**
      * Enumeration of attributes of a CardTerminal.
      * It is used as a parameter to the {@linkplain CardTerminals#list} method.
@@ -78,10 +84,68 @@ public:
         CARD_REMOVAL
     };
 
+    /**
+     * List of terminals. A list handed out is never modified, the registry
+     * replacing it as a whole when the readers change.
+     *
+     * @since 2.6.0
+     */
+    using TerminalList = std::vector<std::shared_ptr<CardTerminal>>;
+
     /**
      * Constructs.
+     *
+     * @param contextManager The manager of the PC/SC context to use.
+     */
+    explicit CardTerminals(std::shared_ptr<ContextManager> contextManager);
+
+    /**
+     * Returns the manager of the PC/SC context used by these terminals.
+     *
+     * @return A not null reference.
+     * @since 2.6.0
+     */
+    std::shared_ptr<ContextManager> getContextManager() const;
+
+    /**
+     * Returns the context to use for the card and reader operations on the
+     * provided reader from the calling thread, according to the context mode.
+     *
+     * @param readerName The name of the reader.
+     * @return A not null reference.
+     * @since 2.6.0
+     */
+    std::shared_ptr<ContextManager> getReaderContextManager(
+        const std::string& readerName);
+
+    /**
+     * Sets the way contexts are allocated to the readers.
+     *
+     * <p>Cards already connected keep the context they were connected with.
+     *
+     * @param mode The context mode.
+     * @since 2.6.0
      */
-    CardTerminals(SCARDCONTEXT& context);
+    void setContextMode(const ContextMode mode);
+
+    /**
+     * Returns the coordinator of the accesses to the readers shared with
+     * other applications.
+     *
+     * @return A not null reference.
+     * @since 2.6.0
+     */
+    std::shared_ptr<AccessCoordinator> getAccessCoordinator();
+
+    /**
+     * Sets the coordinator of the accesses to the readers shared with other
+     * applications (by default, accesses are not retried nor ordered).
+     *
+     * @param accessCoordinator The coordinator, not null.
+     * @since 2.6.0
+     */
+    void setAccessCoordinator(
+        const std::shared_ptr<AccessCoordinator> accessCoordinator);
 
     /**
      * Returns an unmodifiable list of all available terminals.
@@ -89,7 +153,7 @@ public:
      * @return an unmodifiable list of all available terminals.
      * @throw CardException if the card operation failed
      */
-    const std::vector<std::shared_ptr<CardTerminal>> list();
+    std::shared_ptr<const TerminalList> list();
 
     /**
      * Returns an unmodifiable list of all terminals matching the specified
@@ -101,12 +165,16 @@ public:
      * @throw NullPointerException if attr is null
      * @throw CardException if the card operation failed
      */
-    const std::vector<std::shared_ptr<CardTerminal>> list(const State state);
+    std::shared_ptr<const TerminalList> list(const State state);
 
     /**
      * Returns the terminal with the specified name or null if no such
      * terminal exists.
      *
+     * <p>The lookup is done in the registry maintained by update() and does
+     * not query the PC/SC service, except for the very first call if the
+     * registry has never been populated.
+     *
      * @return the terminal with the specified name or null if no such
      * terminal exists.
      *
@@ -114,6 +182,45 @@ public:
      */
     std::shared_ptr<CardTerminal> getTerminal(const std::string& name);
 
+    /**
+     * Refreshes the registry of terminals from the list of readers currently
+     * known by the PC/SC service.
+     *
+     * <p>The CardTerminal instances of the readers still present are kept, so
+     * that the same object is returned for a given reader name as long as the
+     * reader is connected. When the list of readers did not change since the
+     * previous call, nothing is allocated.
+     *
+     * <p>The states of the listed readers are also read at once, so that the
+     * terminals of the readers unplugged and plugged again meanwhile are
+     * replaced (see CardTerminal::isAttached()). Such a reader is reported as
+     * both removed and added.
+     *
+     * @param addedReaderNames Filled with the names of the readers that
+     *        appeared since the previous call.
+     * @param removedReaderNames Filled with the names of the readers that
+     *        disappeared since the previous call.
+     * @return True if the list of readers changed, false if not.
+     * @throw CardTerminalException If the list of readers could not be read.
+     * @since 2.6.0
+     */
+    bool update(
+        std::vector<std::string>& addedReaderNames,
+        std::vector<std::string>& removedReaderNames);
+
+    /**
+     * Returns the terminals currently held by the registry, as populated by
+     * the latest call to update(), without querying the PC/SC service.
+     *
+     * <p>The same list is returned as long as the readers do not change, so
+     * that callers can compare it with the one they got previously instead of
+     * rebuilding what they derive from it.
+     *
+     * @return A not null list of terminals, possibly empty.
+     * @since 2.6.0
+     */
+    std::shared_ptr<const TerminalList> getTerminals();
+
     /**
      * Waits for card insertion or removal in any of the terminals of this
      * object.
@@ -142,6 +249,85 @@ public:
     waitForChange(long timeout);
 
 private:
+    /**
+     *
+     */
+    const std::shared_ptr<Logger> mLogger =
+        LoggerFactory::getLogger(typeid(CardTerminals));
+
+    /**
+     *
+     */
+    const std::shared_ptr<ContextManager> mContextManager;
+
+    /**
+     *
+     */
+    std::shared_ptr<ContextPool> mContextPool;
+
+    /**
+     *
+     */
+    std::shared_ptr<AccessCoordinator> mAccessCoordinator;
+
+    /**
+     * Protects the registry against concurrent updates.
+     */
+    std::mutex mMutex;
+
+    /**
+     * Buffer receiving the multi-string of reader names, reused from one call
+     * to another.
+     */
+    std::vector<char> mReadersBuffer;
+
+    /**
+     * Multi-string of reader names retrieved during the previous update.
+     */
+    std::vector<char> mReadersSnapshot;
+
+    /**
+     * Terminals of the readers currently present, in the PC/SC service order.
+     */
+    std::shared_ptr<const TerminalList> mTerminals;
+
+    /**
+     * Terminals of the readers currently present, indexed by reader name.
+     */
+    std::unordered_map<std::string, std::shared_ptr<CardTerminal>>
+        mTerminalsByName;
+
+    /**
+     *
+     */
+    bool mIsPopulated;
+
+    /**
+     * Reads the multi-string of reader names into the reusable buffer.
+     *
+     * @param context The PC/SC context to use.
+     * @param len Receives the length of the multi-string.
+     * @return The PC/SC error code.
+     */
+    LONG listReaders(const SCARDCONTEXT context, DWORD& len);
+
+    /**
+     * States of the registered readers, reused from one update to another.
+     */
+    std::vector<SCARD_READERSTATE> mReaderStates;
+
+    /**
+     * Replaces the terminals of the readers unplugged and plugged again, the
+     * mutex being held by the caller.
+     *
+     * @param addedReaderNames Filled with the names of the replaced readers.
+     * @param removedReaderNames Filled with the names of the replaced readers.
+     * @return True if at least one terminal has been replaced.
+     */
+    bool renewReplacedTerminals(
+        std::vector<std::string>& addedReaderNames,
+        std::vector<std::string>& removedReaderNames);
+
     /**
      *
      */
@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
+#include <winscard.h>
+#else
+#include <PCSC/wintypes.h>
+#include <PCSC/winscard.h>
+#endif
+
+#include "keyple/core/util/cpp/Logger.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+namespace cpp {
+
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
+
+/**
+ * Owner of a PC/SC context (SCARDCONTEXT).
+ *
+ * <p>The context is established on first use, validated with
+ * SCardIsValidContext when a PC/SC call reports a service failure, and
+ * transparently re-established when it is no longer valid (e.g. after a
+ * restart of pcscd). Each re-establishment increments a generation number
+ * allowing the holders of card handles to detect that their handle belongs
+ * to a former context.
+ */
+class ContextManager {
+public:
+    /**
+     * Constructor. The context is not established until first needed.
+     */
+    ContextManager();
+
+    /**
+     * Destructor. Releases the context if established.
+     */
+    virtual ~ContextManager();
+
+    /**
+     * Non copyable.
+     */
+    ContextManager(const ContextManager&) = delete;
+
+    /**
+     * Non assignable.
+     */
+    ContextManager& operator=(const ContextManager&) = delete;
+
+    /**
+     * Returns the current context, establishing it if needed.
+     *
+     * @return A PC/SC context.
+     * @throw CardTerminalException If the context could not be established.
+     */
+    SCARDCONTEXT getContext();
+
+    /**
+     * Returns the generation of the current context, incremented each time
+     * the context is (re-)established.
+     *
+     * @return A positive integer, zero if no context has ever been
+     *         established.
+     */
+    uint64_t getGeneration() const;
+
+    /**
+     * Attempts to recover from the error code returned by a PC/SC call made
+     * with the context of the provided generation.
+     *
+     * <p>If the error code denotes a stopped or missing service, the context
+     * is re-established. On an invalid handle, it is re-established only if
+     * the context itself no longer validates. Nothing is done if another
+     * thread has already re-established the context since the provided
+     * generation.
+     *
+     * @param rv The error code returned by the failed PC/SC call.
+     * @param generation The generation of the context used by the failed call.
+     * @return True if the call may be retried with a new context, false if
+     *         the error is not related to the context.
+     */
+    bool recover(const LONG rv, const uint64_t generation);
+
+    /**
+     * Returns the duration of the latest re-establishment of the context.
+     *
+     * @return A duration in milliseconds, zero if the context has never been
+     *         re-established.
+     */
+    uint64_t getLastReestablishmentDuration() const;
+
+    /**
+     * Indicates if the provided error code denotes a failure of the PC/SC
+     * service or of the context, as opposed to a reader or card failure.
+     *
+     * @param rv A PC/SC error code.
+     * @return True if the context should be validated.
+     */
+    static bool isServiceError(const LONG rv);
+
+private:
+    /**
+     *
+     */
+    const std::shared_ptr<Logger> mLogger =
+        LoggerFactory::getLogger(typeid(ContextManager));
+
+    /**
+     *
+     */
+    std::mutex mMutex;
+
+    /**
+     *
+     */
+    SCARDCONTEXT mContext;
+
+    /**
+     *
+     */
+    bool mIsEstablished;
+
+    /**
+     *
+     */
+    std::atomic<uint64_t> mGeneration;
+
+    /**
+     *
+     */
+    std::atomic<uint64_t> mLastReestablishmentDuration;
+
+    /**
+     * Establishes a new context, the mutex must be held by the caller.
+     */
+    void establish();
+
+    /**
+     * Releases the current context, the mutex must be held by the caller.
+     */
+    void release();
+};
+
+} /* namespace cpp */
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "keyple/plugin/pcsc/PcscContextMode.hpp"
+#include "keyple/plugin/pcsc/cpp/ContextManager.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+namespace cpp {
+
+using ContextMode = PcscContextMode;
+
+/**
+ * Pool of PC/SC contexts used for the card and reader operations.
+ *
+ * <p>pcsc-lite serializes the calls made on the same context. Depending on
+ * the configured mode, the pool hands out either the shared context, a
+ * dedicated context per reader or a dedicated context per calling thread, so
+ * that operations on different readers are not queued behind each other.
+ */
+class ContextPool {
+public:
+    /**
+     * Constructor.
+     *
+     * @param sharedContextManager The context used in ContextMode::SHARED mode.
+     * @param mode The way contexts are handed out.
+     */
+    ContextPool(
+        std::shared_ptr<ContextManager> sharedContextManager,
+        const ContextMode mode);
+
+    /**
+     * Returns the context to use for an operation on the provided reader from
+     * the calling thread.
+     *
+     * @param readerName The name of the reader.
+     * @return A not null reference.
+     */
+    std::shared_ptr<ContextManager> acquire(const std::string& readerName);
+
+    /**
+     * Releases the dedicated context of a reader that is no longer connected.
+     *
+     * @param readerName The name of the reader.
+     */
+    void release(const std::string& readerName);
+
+    /**
+     * Returns the mode of the pool.
+     *
+     * @return The context mode.
+     */
+    ContextMode getMode() const;
+
+private:
+    /**
+     *
+     */
+    const std::shared_ptr<ContextManager> mSharedContextManager;
+
+    /**
+     *
+     */
+    const ContextMode mMode;
+
+    /**
+     *
+     */
+    std::mutex mMutex;
+
+    /**
+     * Dedicated contexts in ContextMode::PER_READER mode.
+     */
+    std::map<std::string, std::shared_ptr<ContextManager>> mReaderContexts;
+
+    /**
+     * Identifies the pool in the contexts held by the threads in
+     * ContextMode::PER_THREAD mode, expired once the pool is destroyed.
+     */
+    const std::shared_ptr<char> mLifetimeToken;
+};
+
+} /* namespace cpp */
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -15,9 +15,11 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "keyple/plugin/pcsc/cpp/CardTerminals.hpp"
+#include "keyple/plugin/pcsc/cpp/ContextManager.hpp"
 
 #if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
 #include <winscard.h>
@@ -52,24 +54,56 @@ public:
     void operator=(const TerminalFactory&) = delete;
 
     /**
+     * Returns the default factory, shared by all the callers.
      *
+     * <p>The instance is created in a thread-safe way on first call.
      */
     static std::shared_ptr<TerminalFactory> getDefault();
 
     /**
-     * Returns a new CardTerminals object encapsulating the terminals
-     * supported by this factory.
+     * Creates a new factory, independent of the default one and using its
+     * own PC/SC context.
      *
-     * @return a new CardTerminals object encapsulating the terminals
-     * supported by this factory.
+     * @return A not null reference.
+     * @since 2.6.0
+     */
+    static std::shared_ptr<TerminalFactory> newInstance();
+
+    /**
+     * Returns the CardTerminals object encapsulating the terminals supported
+     * by this factory.
+     *
+     * <p>The same object is returned by all the calls, it shares the PC/SC
+     * context managed by this factory.
+     *
+     * @return the CardTerminals object encapsulating the terminals supported
+     * by this factory.
      */
     std::shared_ptr<CardTerminals> terminals();
 
+    /**
+     * Returns the manager of the PC/SC context used by this factory.
+     *
+     * @return A not null reference.
+     * @since 2.6.0
+     */
+    std::shared_ptr<ContextManager> getContextManager() const;
+
 private:
     /**
      *
      */
-    SCARDCONTEXT mContext;
+    const std::shared_ptr<ContextManager> mContextManager;
+
+    /**
+     *
+     */
+    std::shared_ptr<CardTerminals> mTerminals;
+
+    /**
+     *
+     */
+    std::mutex mMutex;
 
     /**
      *
@@ -79,7 +113,12 @@ private:
     /**
      *
      */
-    TerminalFactory() = default;
+    static std::once_flag mInstanceFlag;
+
+    /**
+     *
+     */
+    TerminalFactory();
 
     /**
      *
@@ -0,0 +1,213 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#include "keyple/plugin/pcsc/PcscAtrIdentificationIndex.hpp"
+
+#include <fstream>
+
+#include "keyple/core/util/HexUtil.hpp"
+#include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+using keyple::core::util::HexUtil;
+using keyple::core::util::cpp::exception::IllegalArgumentException;
+
+const int PcscAtrIdentificationIndex::WILDCARD;
+
+PcscAtrIdentificationIndex::Node::Node()
+: mEntry(-1)
+{
+    for (int i = 0; i < 17; i++) {
+        mChildren[i] = -1;
+    }
+}
+
+PcscAtrIdentificationIndex::PcscAtrIdentificationIndex()
+: mNodes(1)
+{
+}
+
+std::shared_ptr<PcscAtrIdentificationIndex>
+PcscAtrIdentificationIndex::loadFromFile(const std::string& path)
+{
+    std::ifstream input(path);
+    if (!input.is_open()) {
+        throw IllegalArgumentException(
+            "Unable to open the ATR database file: " + path);
+    }
+
+    auto index = std::make_shared<PcscAtrIdentificationIndex>();
+    index->load(input);
+
+    return index;
+}
+
+void
+PcscAtrIdentificationIndex::load(std::istream& input)
+{
+    std::string line;
+    std::string currentPattern;
+    bool isCurrentPatternSupported = false;
+    int ignored = 0;
+
+    while (std::getline(input, line)) {
+        if (!line.empty() && line[line.size() - 1] == '\r') {
+            line.erase(line.size() - 1);
+        }
+
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        if (line[0] == '\t') {
+            /* Description of the current pattern */
+            if (isCurrentPatternSupported) {
+                addEntry(currentPattern, line.substr(1));
+            }
+
+        } else {
+            /* New ATR pattern */
+            currentPattern = line;
+            isCurrentPatternSupported = addEntry(currentPattern, "");
+            if (!isCurrentPatternSupported) {
+                ignored++;
+            }
+        }
+    }
+
+    mLogger->debug(
+        "ATR identification index loaded: % patterns, % ignored\n",
+        mEntries.size(),
+        ignored);
+}
+
+bool
+PcscAtrIdentificationIndex::addEntry(
+    const std::string& atrPattern, const std::string& description)
+{
+    std::vector<int> nibbles;
+    nibbles.reserve(atrPattern.size());
+
+    for (const char c : atrPattern) {
+        if (c == ' ') {
+            continue;
+        } else if (c == '.') {
+            nibbles.push_back(WILDCARD);
+        } else if (c >= '0' && c <= '9') {
+            nibbles.push_back(c - '0');
+        } else if (c >= 'A' && c <= 'F') {
+            nibbles.push_back(c - 'A' + 10);
+        } else if (c >= 'a' && c <= 'f') {
+            nibbles.push_back(c - 'a' + 10);
+        } else {
+            /* Other regular expression constructs are not supported */
+            return false;
+        }
+    }
+
+    if (nibbles.empty() || nibbles.size() % 2 != 0) {
+        return false;
+    }
+
+    int32_t nodeIndex = 0;
+    for (const int nibble : nibbles) {
+        int32_t child = mNodes[nodeIndex].mChildren[nibble];
+        if (child < 0) {
+            child = static_cast<int32_t>(mNodes.size());
+            mNodes.push_back(Node());
+            mNodes[nodeIndex].mChildren[nibble] = child;
+        }
+        nodeIndex = child;
+    }
+
+    if (mNodes[nodeIndex].mEntry < 0) {
+        mNodes[nodeIndex].mEntry = static_cast<int32_t>(mEntries.size());
+        mEntries.push_back(std::vector<std::string>());
+    }
+
+    if (!description.empty()) {
+        mEntries[mNodes[nodeIndex].mEntry].push_back(description);
+    }
+
+    return true;
+}
+
+int32_t
+PcscAtrIdentificationIndex::find(
+    const std::vector<uint8_t>& atr,
+    const size_t nibbleIndex,
+    const int32_t nodeIndex) const
+{
+    const Node& node = mNodes[nodeIndex];
+
+    if (nibbleIndex == atr.size() * 2) {
+        return node.mEntry;
+    }
+
+    const uint8_t b = atr[nibbleIndex / 2];
+    const int nibble = (nibbleIndex % 2 == 0) ? (b >> 4) : (b & 0x0F);
+
+    /* Exact branch first, so that the most specific pattern wins */
+    if (node.mChildren[nibble] >= 0) {
+        const int32_t entry = find(atr, nibbleIndex + 1, node.mChildren[nibble]);
+        if (entry >= 0) {
+            return entry;
+        }
+    }
+
+    if (node.mChildren[WILDCARD] >= 0) {
+        return find(atr, nibbleIndex + 1, node.mChildren[WILDCARD]);
+    }
+
+    return -1;
+}
+
+const std::vector<std::string>&
+PcscAtrIdentificationIndex::identify(const std::vector<uint8_t>& atr) const
+{
+    static const std::vector<std::string> unknown;
+
+    if (atr.empty()) {
+        return unknown;
+    }
+
+    const int32_t entry = find(atr, 0, 0);
+
+    return entry >= 0 ? mEntries[entry] : unknown;
+}
+
+const std::vector<std::string>&
+PcscAtrIdentificationIndex::identify(const std::string& powerOnData) const
+{
+    static const std::vector<std::string> unknown;
+
+    if (!HexUtil::isValid(powerOnData)) {
+        return unknown;
+    }
+
+    return identify(HexUtil::toByteArray(powerOnData));
+}
+
+size_t
+PcscAtrIdentificationIndex::size() const
+{
+    return mEntries.size();
+}
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -13,7 +13,12 @@
 
 #include "keyple/plugin/pcsc/PcscPluginAdapter.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "keyple/core/plugin/PluginIOException.hpp"
+#include "keyple/core/util/HexUtil.hpp"
 #include "keyple/core/util/cpp/KeypleStd.hpp"
 #include "keyple/core/util/cpp/StringUtils.hpp"
 #include "keyple/core/util/cpp/exception/Exception.hpp"
@@ -26,29 +31,54 @@
 #include "keyple/plugin/pcsc/cpp/CardTerminal.hpp"
 #include "keyple/plugin/pcsc/cpp/CardTerminals.hpp"
 #include "keyple/plugin/pcsc/cpp/TerminalFactory.hpp"
+#include "keyple/plugin/pcsc/cpp/exception/CardException.hpp"
 #include "keyple/plugin/pcsc/cpp/exception/CardTerminalException.hpp"
 
+#include "cpp/PcscUtils.hpp"
+
 namespace keyple {
 namespace plugin {
 namespace pcsc {
 
 using keyple::core::plugin::PluginIOException;
+using keyple::core::util::HexUtil;
 using keyple::core::util::cpp::StringUtils;
 using keyple::core::util::cpp::exception::Exception;
 using keyple::core::util::cpp::exception::IllegalArgumentException;
 using keyple::plugin::pcsc::cpp::CardTerminal;
 using keyple::plugin::pcsc::cpp::CardTerminals;
 using keyple::plugin::pcsc::cpp::TerminalFactory;
+using keyple::plugin::pcsc::cpp::exception::CardException;
 using keyple::plugin::pcsc::cpp::exception::CardTerminalException;
 
 std::shared_ptr<PcscPluginAdapter> PcscPluginAdapter::INSTANCE;
 
+std::once_flag PcscPluginAdapter::INSTANCE_FLAG;
+
 const int PcscPluginAdapter::MONITORING_CYCLE_DURATION_MS = 1000;
 
+
 PcscPluginAdapter::PcscPluginAdapter()
+: PcscPluginAdapter(
+    PcscPluginFactoryAdapter::PLUGIN_NAME, TerminalFactory::getDefault())
+{
+}
+
+PcscPluginAdapter::PcscPluginAdapter(
+    const std::string& name, std::shared_ptr<TerminalFactory> terminalFactory)
 : PcscPlugin()
 , ObservablePluginSpi()
+, mName(name)
+, mTerminalFactory(terminalFactory)
 , mIsCardTerminalsInitialized(false)
+, mIsLazyInitialization(false)
+, mIsSpeculativeConnection(false)
+, mIsSessionReuse(false)
+, mReaderCommandQueueCapacity(0)
+, mReaderExecutorThreadCount(0)
+, mIsBackgroundInitializationStarted(false)
+, mIsTerminalsReady(false)
+, mContextMode(ContextMode::SHARED)
 {
     /* Initializes the protocol rules map with default values. */
     mProtocolRulesMap = {
@@ -78,12 +108,16 @@ PcscPluginAdapter::PcscPluginAdapter()
          PcscSupportedContactProtocol::ISO_7816_3_T1.getDefaultRule()}};
 }
 
+PcscPluginAdapter::~PcscPluginAdapter()
+{
+    joinInitializationThread();
+}
+
 std::shared_ptr<PcscPluginAdapter>
 PcscPluginAdapter::getInstance()
 {
-    if (!INSTANCE) {
-        INSTANCE = std::make_shared<PcscPluginAdapter>();
-    }
+    std::call_once(
+        INSTANCE_FLAG, []() { INSTANCE = std::make_shared<PcscPluginAdapter>(); });
 
     return INSTANCE;
 }
@@ -95,6 +129,46 @@ PcscPluginAdapter::createReader(std::shared_ptr<CardTerminal> terminal)
         terminal, shared_from_this(), mCardMonitoringCycleDuration));
 }
 
+std::shared_ptr<PcscReaderAdapter>
+PcscPluginAdapter::getOrCreateReader(std::shared_ptr<CardTerminal> terminal)
+{
+    std::lock_guard<std::mutex> lock(mReaderAdaptersMutex);
+
+    auto& readerAdapter = mReaderAdapters[terminal->getName()];
+    if (readerAdapter != nullptr && readerAdapter->getTerminal() != terminal) {
+        /* Adapter of a former reader plugged under the same name */
+        readerAdapter->releaseDirectConnection();
+        readerAdapter = nullptr;
+    }
+
+    if (readerAdapter == nullptr) {
+        readerAdapter = createReader(terminal);
+    }
+
+    return readerAdapter;
+}
+
+std::shared_ptr<PcscReaderAdapter>
+PcscPluginAdapter::bringUpReader(std::shared_ptr<CardTerminal> terminal)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    auto readerAdapter = getOrCreateReader(terminal);
+
+    /* Initial probing, the results are cached for the next adapters */
+    readerAdapter->isContactless();
+
+    mLogger->trace(
+        "Plugin [%]: reader [%] brought up in % us\n",
+        getName(),
+        terminal->getName(),
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+
+    return readerAdapter;
+}
+
 int
 PcscPluginAdapter::getMonitoringCycleDuration() const
 {
@@ -104,36 +178,73 @@ PcscPluginAdapter::getMonitoringCycleDuration() const
 const std::vector<std::string>
 PcscPluginAdapter::searchAvailableReaderNames()
 {
-    std::vector<std::string> readerNames;
-
     mLogger->trace("Plugin [%]: search available reader\n", getName());
 
-    for (const auto& terminal : getCardTerminalList()) {
-        readerNames.push_back(terminal->getName());
+    if (!isTerminalsReady()) {
+        return std::vector<std::string>();
     }
 
-    mLogger->trace("Plugin [%]: readers found: %", getName(), readerNames);
+    const auto terminals = getCardTerminalList();
 
-    return readerNames;
+    std::lock_guard<std::mutex> lock(mTerminalListMutex);
+
+    /* The names are only rebuilt when the readers changed */
+    if (terminals != mReaderNamesSource) {
+        mReaderNames.clear();
+        for (const auto& terminal : *terminals) {
+            mReaderNames.push_back(terminal->getName());
+        }
+
+        mReaderNamesSource = terminals;
+
+        mLogger->trace(
+            "Plugin [%]: readers found: %\n", getName(), mReaderNames);
+    }
+
+    return mReaderNames;
 }
 
 const std::string&
 PcscPluginAdapter::getName() const
 {
-    return PcscPluginFactoryAdapter::PLUGIN_NAME;
+    return mName;
 }
 
 const std::vector<std::shared_ptr<ReaderSpi>>
 PcscPluginAdapter::searchAvailableReaders()
 {
-    std::vector<std::shared_ptr<ReaderSpi>> readerSpis;
-
     mLogger->trace("Plugin [%]: search available readers\n", getName());
 
-    for (const auto& terminal : getCardTerminalList()) {
-        readerSpis.push_back(createReader(terminal));
+    if (!isTerminalsReady()) {
+        mLogger->debug(
+            "Plugin [%]: lazy initialization, readers will be announced once "
+            "discovered\n",
+            getName());
+        return std::vector<std::shared_ptr<ReaderSpi>>(0);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto terminals = getCardTerminalList();
+    const size_t count = terminals->size();
+
+    /*
+     * The bring-up of a reader does no device I/O, readers are therefore
+     * brought up sequentially in the order of the PC/SC service.
+     */
+    std::vector<std::shared_ptr<ReaderSpi>> readerSpis;
+    readerSpis.reserve(count);
+    for (const auto& terminal : *terminals) {
+        readerSpis.push_back(bringUpReader(terminal));
     }
 
+    mLogger->debug(
+        "Plugin [%]: % reader(s) brought up in % ms\n",
+        getName(),
+        count,
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+
     for (const auto& readerSpi : readerSpis) {
         mLogger->trace(
             "Plugin [%]: reader found: %\n", getName(), readerSpi->getName());
@@ -145,24 +256,101 @@ PcscPluginAdapter::searchAvailableReaders()
 void
 PcscPluginAdapter::onUnregister()
 {
-    /* Nothing to do here in this plugin */
+    joinInitializationThread();
+
+    /* Release the reader adapters, they hold a reference to the plugin */
+    std::lock_guard<std::mutex> lock(mReaderAdaptersMutex);
+    for (const auto& entry : mReaderAdapters) {
+        entry.second->releaseDirectConnection();
+    }
+
+    mReaderAdapters.clear();
 }
 
-const std::vector<std::shared_ptr<CardTerminal>>
-PcscPluginAdapter::getCardTerminalList()
+std::shared_ptr<CardTerminals>
+PcscPluginAdapter::getTerminals()
+{
+    if (!mIsCardTerminalsInitialized) {
+        std::lock_guard<std::mutex> lock(mTerminalsMutex);
+        if (!mIsCardTerminalsInitialized) {
+            const std::shared_ptr<CardTerminals> terminals
+                = mTerminalFactory->terminals();
+            terminals->setContextMode(mContextMode);
+            if (mAccessCoordinator != nullptr) {
+                terminals->setAccessCoordinator(mAccessCoordinator);
+            }
+            std::atomic_store(&mTerminals, terminals);
+            mIsCardTerminalsInitialized = true;
+        }
+    }
+
+    return std::atomic_load(&mTerminals);
+}
+
+std::shared_ptr<const CardTerminals::TerminalList>
+PcscPluginAdapter::updateCardTerminalList()
 {
     /*
      * Parse the current readers list to create the ReaderSpi(s) associated with
      * new reader(s).
      */
+    const std::shared_ptr<CardTerminals> cardTerminals = getTerminals();
+
+    std::vector<std::string> addedReaderNames;
+    std::vector<std::string> removedReaderNames;
+
+    if (cardTerminals->update(addedReaderNames, removedReaderNames)) {
+        for (const auto& readerName : addedReaderNames) {
+            if (!isReaderIncluded(readerName)) {
+                mLogger->debug(
+                    "Plugin [%]: reader [%] ignored by the reader filters\n",
+                    getName(),
+                    readerName);
+            }
+        }
 
-    try {
-        if (!mIsCardTerminalsInitialized) {
-            mTerminals = TerminalFactory::getDefault()->terminals();
-            mIsCardTerminalsInitialized = true;
+        /* Forget the adapters of the removed readers */
+        std::lock_guard<std::mutex> lock(mReaderAdaptersMutex);
+        for (const auto& readerName : removedReaderNames) {
+            const auto it = mReaderAdapters.find(readerName);
+            if (it != mReaderAdapters.end()) {
+                it->second->releaseDirectConnection();
+                mReaderAdapters.erase(it);
+            }
+        }
+    }
+
+    const auto terminals = cardTerminals->getTerminals();
+
+    if (mReaderInclusionFilterPattern == nullptr
+        && mReaderExclusionFilterPattern == nullptr) {
+        return terminals;
+    }
+
+    std::lock_guard<std::mutex> lock(mTerminalListMutex);
+
+    /* The filters are only applied again when the readers changed */
+    if (terminals != mIncludedTerminalsSource) {
+        CardTerminals::TerminalList includedTerminals;
+        for (const auto& terminal : *terminals) {
+            if (isReaderIncluded(terminal->getName())) {
+                includedTerminals.push_back(terminal);
+            }
         }
 
-        return mTerminals->list();
+        mIncludedTerminals = std::make_shared<const CardTerminals::TerminalList>(
+            std::move(includedTerminals));
+        mIncludedTerminalsSource = terminals;
+    }
+
+    return mIncludedTerminals;
+}
+
+std::shared_ptr<const CardTerminals::TerminalList>
+PcscPluginAdapter::getCardTerminalList()
+{
+    try {
+        return updateCardTerminalList();
 
     } catch (const Exception& e) {
         const auto msg = e.getMessage();
@@ -173,9 +361,12 @@ PcscPluginAdapter::getCardTerminalList()
         } else if (
             StringUtils::contains(msg, "SCARD_E_NO_SERVICE")
             || StringUtils::contains(msg, "SCARD_E_SERVICE_STOPPED")) {
+            /*
+             * The context is validated and re-established by the context
+             * manager on the next access, no need to recreate the terminals.
+             */
             mLogger->error(
                 "Plugin [%]: no smart card service error\n", getName());
-            mIsCardTerminalsInitialized = false;
 
         } else if (StringUtils::contains(msg, "SCARD_F_COMM_ERROR")) {
             mLogger->error(
@@ -188,7 +379,7 @@ PcscPluginAdapter::getCardTerminalList()
         }
     }
 
-    return std::vector<std::shared_ptr<CardTerminal>>(0);
+    return std::make_shared<const CardTerminals::TerminalList>();
 }
 
 std::shared_ptr<ReaderSpi>
@@ -196,17 +387,52 @@ PcscPluginAdapter::searchReader(const std::string& readerName)
 {
     mLogger->trace("Plugin [%]: search reader [%]\n", getName(), readerName);
 
-    const auto terminals = getCardTerminalList();
-    auto it = std::find_if(
-        terminals.begin(),
-        terminals.end(),
-        [readerName](const std::shared_ptr<CardTerminal>& terminal) {
-            return terminal->getName() == readerName;
-        });
-
-    if (it != terminals.end()) {
+    if (!isReaderIncluded(readerName)) {
+        mLogger->trace("Plugin [%]: reader not handled\n", getName());
+        return nullptr;
+    }
+
+    if (!isTerminalsReady()) {
+        mLogger->trace("Plugin [%]: readers not yet initialized\n", getName());
+        return nullptr;
+    }
+
+    std::shared_ptr<PcscReaderAdapter> readerAdapter;
+    {
+        std::lock_guard<std::mutex> lock(mReaderAdaptersMutex);
+        const auto it = mReaderAdapters.find(readerName);
+        if (it != mReaderAdapters.end()) {
+            readerAdapter = it->second;
+        }
+    }
+
+    /*
+     * The adapter of a reader unplugged and plugged again between two scans
+     * is forgotten by the update that renews its terminal.
+     */
+    if (readerAdapter != nullptr) {
         mLogger->trace("Plugin [%]: reader found\n", getName());
-        return createReader(*it);
+        return readerAdapter;
+    }
+
+    /*
+     * The terminals registry is kept up to date by the plugin monitoring, the
+     * lookup does not query the PC/SC service.
+     */
+    if (!mIsCardTerminalsInitialized) {
+        getCardTerminalList();
+    }
+
+    const std::shared_ptr<CardTerminals> cardTerminals
+        = std::atomic_load(&mTerminals);
+
+    const auto terminal = cardTerminals != nullptr
+                              ? cardTerminals->getTerminal(readerName)
+                              : nullptr;
+
+    if (terminal != nullptr) {
+        mLogger->trace("Plugin [%]: reader found\n", getName());
+        return getOrCreateReader(terminal);
     }
 
     mLogger->trace("Plugin [%]: reader not found\n", getName());
@@ -233,17 +459,249 @@ PcscPluginAdapter::getProtocolRule(const std::string& readerProtocol) const
 bool
 PcscPluginAdapter::isContactless(const std::string& readerName)
 {
-    return mContactlessReaderIdentificationFilterPattern->matcher(readerName)
-        ->matches();
+    return getReaderProfile(readerName)->isContactless();
+}
+
+std::shared_ptr<PcscReaderProfile>
+PcscPluginAdapter::getReaderProfile(const std::string& readerName)
+{
+    std::lock_guard<std::mutex> lock(mReaderProfilesMutex);
+
+    const auto it = mReaderProfiles.find(readerName);
+    if (it != mReaderProfiles.end()) {
+        return it->second;
+    }
+
+    const bool contactless
+        = mContactlessReaderIdentificationFilterPattern->matcher(readerName)
+              ->matches()
+          && (mContactReaderIdentificationFilterPattern == nullptr
+              || !mContactReaderIdentificationFilterPattern->matcher(readerName)
+                      ->matches());
+    auto profile = std::make_shared<PcscReaderProfile>(readerName, contactless);
+    mReaderProfiles.insert({readerName, profile});
+
+    if (mReaderCapabilityCache != nullptr
+        && mReaderCapabilityCache->restore(*profile)) {
+        mLogger->trace(
+            "Plugin [%]: reader [%] capabilities restored from cache\n",
+            getName(),
+            readerName);
+    }
+
+    mLogger->trace(
+        "Plugin [%]: reader [%] profiled as contactless: %\n",
+        getName(),
+        readerName,
+        contactless);
+
+    return profile;
+}
+
+const std::vector<std::string>
+PcscPluginAdapter::getDeviceReaderNames(const std::string& deviceName)
+{
+    std::vector<std::string> readerNames;
+
+    if (!isTerminalsReady()) {
+        return readerNames;
+    }
+
+    const std::shared_ptr<CardTerminals> cardTerminals
+        = std::atomic_load(&mTerminals);
+    if (cardTerminals == nullptr) {
+        return readerNames;
+    }
+
+    for (const auto& terminal : *cardTerminals->getTerminals()) {
+        const std::string& readerName = terminal->getName();
+        if (isReaderIncluded(readerName)
+            && PcscReaderProfile::getDeviceName(readerName) == deviceName) {
+            readerNames.push_back(readerName);
+        }
+    }
+
+    return readerNames;
+}
+
+std::shared_ptr<PcscReaderProfile>
+PcscPluginAdapter::findValidatedDeviceProfile(
+    const std::shared_ptr<PcscReaderProfile> profile)
+{
+    std::lock_guard<std::mutex> lock(mReaderProfilesMutex);
+
+    for (const auto& entry : mReaderProfiles) {
+        if (entry.second != profile
+            && entry.second->getDeviceName() == profile->getDeviceName()
+            && entry.second->isValidated()) {
+            return entry.second;
+        }
+    }
+
+    return nullptr;
+}
+
+void
+PcscPluginAdapter::validateReaderProfile(
+    const std::string& readerName, const std::shared_ptr<Card> card)
+{
+    const std::shared_ptr<PcscReaderProfile> profile
+        = getReaderProfile(readerName);
+    if (profile->isValidated()) {
+        return;
+    }
+
+    /* The slots of a device share its firmware, probe it only once */
+    const std::shared_ptr<PcscReaderProfile> deviceProfile
+        = findValidatedDeviceProfile(profile);
+    if (deviceProfile != nullptr) {
+        profile->validate(
+            deviceProfile->getFirmwareVersion(),
+            deviceProfile->getMaxInputSize());
+        mLogger->trace(
+            "Plugin [%]: reader [%] capabilities shared with reader [%]\n",
+            getName(),
+            readerName,
+            deviceProfile->getReaderName());
+
+        storeReaderProfile(profile);
+
+        return;
+    }
+
+    try {
+        const std::string firmwareVersion
+            = HexUtil::toHex(card->getAttribute(SCARD_ATTR_VENDOR_IFD_VERSION));
+
+        /* The cached capabilities are kept as long as the firmware is the same */
+        if (profile->getMaxInputSize() >= 0
+            && profile->getFirmwareVersion() == firmwareVersion) {
+            profile->validate(firmwareVersion, profile->getMaxInputSize());
+            mLogger->trace(
+                "Plugin [%]: reader [%] cached capabilities confirmed\n",
+                getName(),
+                readerName);
+            return;
+        }
+
+        /* SCARD_ATTR_MAXINPUT is a DWORD, in the host byte order (LE) */
+        int maxInputSize = -1;
+        try {
+            const std::vector<uint8_t> value
+                = card->getAttribute(SCARD_ATTR_MAXINPUT);
+            if (value.size() >= 4) {
+                maxInputSize = value[0] | (value[1] << 8) | (value[2] << 16)
+                               | (value[3] << 24);
+            }
+
+        } catch (const CardException& e) {
+            /* Not supported by all the drivers */
+            (void)e;
+        }
+
+        profile->validate(firmwareVersion, maxInputSize);
+
+        mLogger->debug(
+            "Plugin [%]: reader [%] capabilities: firmware=%, maxInput=%\n",
+            getName(),
+            readerName,
+            firmwareVersion,
+            maxInputSize);
+
+        storeReaderProfile(profile);
+
+    } catch (const CardException& e) {
+        mLogger->debug(
+            "Plugin [%]: unable to read the capabilities of reader [%]: %\n",
+            getName(),
+            readerName,
+            e.getMessage());
+    }
+}
+
+void
+PcscPluginAdapter::storeReaderProfile(
+    const std::shared_ptr<PcscReaderProfile> profile)
+{
+    if (mReaderCapabilityCache != nullptr) {
+        mReaderCapabilityCache->store(*profile);
+    }
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setReaderCapabilityCache(
+    const std::shared_ptr<PcscReaderCapabilityCache> readerCapabilityCache)
+{
+    mReaderCapabilityCache = readerCapabilityCache;
+
+    return *this;
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setReaderInclusionFilterPattern(
+    const std::shared_ptr<Pattern> readerInclusionFilter)
+{
+    mReaderInclusionFilterPattern = readerInclusionFilter;
+
+    /* The lists derived from the terminals are filtered again */
+    std::lock_guard<std::mutex> lock(mTerminalListMutex);
+    mIncludedTerminalsSource = nullptr;
+    mReaderNamesSource = nullptr;
+
+    return *this;
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setReaderExclusionFilterPattern(
+    const std::shared_ptr<Pattern> readerExclusionFilter)
+{
+    mReaderExclusionFilterPattern = readerExclusionFilter;
+
+    /* The lists derived from the terminals are filtered again */
+    std::lock_guard<std::mutex> lock(mTerminalListMutex);
+    mIncludedTerminalsSource = nullptr;
+    mReaderNamesSource = nullptr;
+
+    return *this;
+}
+
+bool
+PcscPluginAdapter::isReaderIncluded(const std::string& readerName) const
+{
+    return (mReaderInclusionFilterPattern == nullptr
+            || mReaderInclusionFilterPattern->matcher(readerName)->matches())
+           && (mReaderExclusionFilterPattern == nullptr
+               || !mReaderExclusionFilterPattern->matcher(readerName)
+                       ->matches());
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setContactReaderIdentificationFilterPattern(
+    const std::shared_ptr<Pattern> contactReaderIdentificationFilter)
+{
+    std::lock_guard<std::mutex> lock(mReaderProfilesMutex);
+
+    mContactReaderIdentificationFilterPattern
+        = contactReaderIdentificationFilter;
+
+    /* Profiles computed with the previous filter are no longer relevant */
+    mReaderProfiles.clear();
+
+    return *this;
 }
 
 PcscPluginAdapter&
 PcscPluginAdapter::setContactlessReaderIdentificationFilterPattern(
     const std::shared_ptr<Pattern> contactlessReaderIdentificationFilter)
 {
+    std::lock_guard<std::mutex> lock(mReaderProfilesMutex);
+
     mContactlessReaderIdentificationFilterPattern
         = contactlessReaderIdentificationFilter;
 
+    /* Profiles computed with the previous filter are no longer relevant */
+    mReaderProfiles.clear();
+
     return *this;
 }
 
@@ -276,6 +734,204 @@ PcscPluginAdapter::setCardMonitoringCycleDuration(
     return *this;
 }
 
+PcscPluginAdapter&
+PcscPluginAdapter::setAtrIdentificationIndex(
+    const std::shared_ptr<PcscAtrIdentificationIndex> atrIdentificationIndex)
+{
+    if (atrIdentificationIndex != nullptr) {
+        mLogger->info(
+            "Plugin [%]: use ATR identification index (% patterns)\n",
+            getName(),
+            atrIdentificationIndex->size());
+    }
+
+    mAtrIdentificationIndex = atrIdentificationIndex;
+
+    return *this;
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setAccessCoordinator(
+    const std::shared_ptr<AccessCoordinator> accessCoordinator)
+{
+    mAccessCoordinator = accessCoordinator;
+
+    const std::shared_ptr<CardTerminals> cardTerminals
+        = std::atomic_load(&mTerminals);
+    if (cardTerminals != nullptr && accessCoordinator != nullptr) {
+        cardTerminals->setAccessCoordinator(accessCoordinator);
+    }
+
+    return *this;
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setContextMode(const ContextMode contextMode)
+{
+    mContextMode = contextMode;
+
+    const std::shared_ptr<CardTerminals> cardTerminals
+        = std::atomic_load(&mTerminals);
+    if (cardTerminals != nullptr) {
+        cardTerminals->setContextMode(contextMode);
+    }
+
+    return *this;
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setLazyInitialization(const bool isLazyInitialization)
+{
+    mIsLazyInitialization = isLazyInitialization;
+
+    return *this;
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setSpeculativeConnection(const bool isSpeculativeConnection)
+{
+    mIsSpeculativeConnection = isSpeculativeConnection;
+
+    return *this;
+}
+
+bool
+PcscPluginAdapter::isSpeculativeConnection() const
+{
+    return mIsSpeculativeConnection;
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setSessionReuse(const bool isSessionReuse)
+{
+    mIsSessionReuse = isSessionReuse;
+
+    return *this;
+}
+
+bool
+PcscPluginAdapter::isSessionReuse() const
+{
+    return mIsSessionReuse;
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setReaderCommandQueueCapacity(const int capacity)
+{
+    mReaderCommandQueueCapacity = capacity;
+
+    return *this;
+}
+
+int
+PcscPluginAdapter::getReaderCommandQueueCapacity() const
+{
+    return mReaderCommandQueueCapacity;
+}
+
+PcscPluginAdapter&
+PcscPluginAdapter::setReaderExecutorThreadCount(const int threadCount)
+{
+    std::lock_guard<std::mutex> lock(mReaderExecutorMutex);
+
+    /* The readers already created keep the executor they were given */
+    if (threadCount != mReaderExecutorThreadCount) {
+        mReaderExecutorThreadCount = threadCount;
+        mReaderExecutor = nullptr;
+    }
+
+    return *this;
+}
+
+std::shared_ptr<PcscReaderExecutor>
+PcscPluginAdapter::getReaderExecutor()
+{
+    std::lock_guard<std::mutex> lock(mReaderExecutorMutex);
+
+    if (mReaderExecutor == nullptr && mReaderExecutorThreadCount > 0) {
+        mReaderExecutor
+            = std::make_shared<PcscReaderExecutor>(mReaderExecutorThreadCount);
+    }
+
+    return mReaderExecutor;
+}
+
+bool
+PcscPluginAdapter::isTerminalsReady()
+{
+    if (!mIsLazyInitialization || mIsTerminalsReady) {
+        return true;
+    }
+
+    if (mIsBackgroundInitializationStarted.exchange(true)) {
+        return false;
+    }
+
+    /*
+     * The thread is joined by onUnregister and by the destructor, it can use
+     * the plugin without holding a reference to it.
+     */
+    std::lock_guard<std::mutex> lock(mInitializationThreadMutex);
+
+    /* A former attempt that failed, already completed */
+    if (mInitializationThread.joinable()) {
+        mInitializationThread.join();
+    }
+
+    mInitializationThread = std::thread([this]() {
+        const auto start = std::chrono::steady_clock::now();
+
+        try {
+            /*
+             * The errors are not filtered here, a missing smart card service
+             * must not mark the terminals as ready.
+             */
+            const size_t count = updateCardTerminalList()->size();
+            mIsTerminalsReady = true;
+
+            mLogger->info(
+                "Plugin [%]: % reader(s) discovered in background in % ms\n",
+                getName(),
+                count,
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count());
+
+        } catch (const Exception& e) {
+            /* Retried on the next search */
+            mLogger->error(
+                "Plugin [%]: background initialization failed: %\n",
+                getName(),
+                e.getMessage());
+            mIsBackgroundInitializationStarted = false;
+        }
+    });
+
+    return false;
+}
+
+void
+PcscPluginAdapter::joinInitializationThread()
+{
+    std::lock_guard<std::mutex> lock(mInitializationThreadMutex);
+
+    if (mInitializationThread.joinable()) {
+        mInitializationThread.join();
+    }
+}
+
+const std::vector<std::string>&
+PcscPluginAdapter::identifyCard(const std::string& powerOnData) const
+{
+    static const std::vector<std::string> unknown;
+
+    if (mAtrIdentificationIndex == nullptr) {
+        return unknown;
+    }
+
+    return mAtrIdentificationIndex->identify(powerOnData);
+}
+
 } /* namespace pcsc */
 } /* namespace plugin */
 } /* namespace keyple */
@@ -17,6 +17,7 @@
 #include "keyple/core/plugin/PluginApiProperties.hpp"
 #include "keyple/plugin/pcsc/PcscPluginAdapter.hpp"
 #include "keyple/plugin/pcsc/PcscPluginFactory.hpp"
+#include "keyple/plugin/pcsc/cpp/TerminalFactory.hpp"
 
 namespace keyple {
 namespace plugin {
@@ -24,17 +25,13 @@ namespace pcsc {
 
 using keyple::core::common::CommonApiProperties_VERSION;
 using keyple::core::plugin::PluginApiProperties_VERSION;
+using keyple::plugin::pcsc::cpp::TerminalFactory;
 
 const std::string PcscPluginFactoryAdapter::PLUGIN_NAME = "PcscPlugin";
 
 PcscPluginFactoryAdapter::PcscPluginFactoryAdapter(
-    const std::shared_ptr<Pattern> contactlessReaderIdentificationFilterPattern,
-    const std::map<std::string, std::string>& protocolRulesMap,
-    const int cardMonitoringCycleDuration)
-: mProtocolRulesMap(protocolRulesMap)
-, mContactlessReaderIdentificationFilterPattern(
-      contactlessReaderIdentificationFilterPattern)
-, mCardMonitoringCycleDuration(cardMonitoringCycleDuration)
+    const Configuration& configuration)
+: mConfiguration(configuration)
 {
 }
 
@@ -53,20 +50,44 @@ PcscPluginFactoryAdapter::getCommonApiVersion() const
 const std::string&
 PcscPluginFactoryAdapter::getPluginName() const
 {
-    return PLUGIN_NAME;
+    return mConfiguration.pluginName;
 }
 
 std::shared_ptr<PluginSpi>
 PcscPluginFactoryAdapter::getPlugin()
 {
+    /*
+     * The default plugin is the single instance, any other name gets its own
+     * instance with its own PC/SC context.
+     */
     std::shared_ptr<PcscPluginAdapter> plugin
-        = PcscPluginAdapter::getInstance();
+        = mConfiguration.pluginName == PLUGIN_NAME
+              ? PcscPluginAdapter::getInstance()
+              : std::make_shared<PcscPluginAdapter>(
+                  mConfiguration.pluginName, TerminalFactory::newInstance());
 
     plugin
         ->setContactlessReaderIdentificationFilterPattern(
-            mContactlessReaderIdentificationFilterPattern)
-        .addProtocolRulesMap(mProtocolRulesMap)
-        .setCardMonitoringCycleDuration(mCardMonitoringCycleDuration);
+            mConfiguration.contactlessReaderIdentificationFilterPattern)
+        .setContactReaderIdentificationFilterPattern(
+            mConfiguration.contactReaderIdentificationFilterPattern)
+        .addProtocolRulesMap(mConfiguration.protocolRulesMap)
+        .setCardMonitoringCycleDuration(
+            mConfiguration.cardMonitoringCycleDuration)
+        .setAtrIdentificationIndex(mConfiguration.atrIdentificationIndex)
+        .setContextMode(mConfiguration.contextMode)
+        .setLazyInitialization(mConfiguration.isLazyInitialization)
+        .setSpeculativeConnection(mConfiguration.isSpeculativeConnection)
+        .setSessionReuse(mConfiguration.isSessionReuse)
+        .setReaderCommandQueueCapacity(
+            mConfiguration.readerCommandQueueCapacity)
+        .setReaderExecutorThreadCount(mConfiguration.readerExecutorThreadCount)
+        .setReaderInclusionFilterPattern(
+            mConfiguration.readerInclusionFilterPattern)
+        .setReaderExclusionFilterPattern(
+            mConfiguration.readerExclusionFilterPattern)
+        .setReaderCapabilityCache(mConfiguration.readerCapabilityCache)
+        .setAccessCoordinator(mConfiguration.accessCoordinator);
 
     return plugin;
 }
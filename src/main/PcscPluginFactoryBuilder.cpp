@@ -13,6 +13,8 @@
 
 #include "keyple/plugin/pcsc/PcscPluginFactoryBuilder.hpp"
 
+#include <thread>
+
 #include "keyple/core/util/KeypleAssert.hpp"
 #include "keyple/core/util/cpp/Pattern.hpp"
 #include "keyple/core/util/cpp/exception/Exception.hpp"
@@ -29,23 +31,48 @@ using keyple::core::util::cpp::exception::Exception;
 using keyple::core::util::cpp::exception::IllegalArgumentException;
 
 using Builder = PcscPluginFactoryBuilder::Builder;
+using ContextMode = PcscPluginFactoryBuilder::ContextMode;
 
 const std::string Builder::DEFAULT_CONTACTLESS_READER_FILTER
     = ".*(contactless|ask logo|acs acr122).*";
 
+const int Builder::DEFAULT_READER_COMMAND_QUEUE_CAPACITY = 64;
+
 /* BUILDER ------------------------------------------------------------------ */
 
 Builder::Builder()
 : mContactlessReaderIdentificationFilterPattern(
     Pattern::compile(Builder::DEFAULT_CONTACTLESS_READER_FILTER))
 , mCardMonitoringCycleDuration(500)
+, mContextMode(ContextMode::SHARED)
+, mIsLazyInitialization(false)
+, mIsSpeculativeConnection(false)
+, mIsSessionReuse(false)
+, mPluginName(PcscPluginFactoryAdapter::PLUGIN_NAME)
+, mSharedAccessMaxAttempts(1)
+, mSharedAccessMaxBackoff(0)
+, mIsCrossProcessAccessLock(false)
+, mReaderCommandQueueCapacity(0)
+, mReaderExecutorThreadCount(0)
 {
 }
 
 Builder&
 Builder::useContactReaderIdentificationFilter(
-    const std::string& /*contactReaderIdentificationFilter*/)
+    const std::string& contactReaderIdentificationFilter)
 {
+    Assert::getInstance().notEmpty(
+        contactReaderIdentificationFilter, "contactReaderIdentificationFilter");
+
+    try {
+        mContactReaderIdentificationFilterPattern
+            = Pattern::compile(contactReaderIdentificationFilter);
+
+    } catch (const Exception& e) {
+        throw IllegalArgumentException(
+            "Bad regular expression.", std::make_shared<Exception>(e));
+    }
+
     return *this;
 }
 
@@ -96,13 +123,184 @@ Builder::setCardMonitoringCycleDuration(const int cycleDuration)
     return *this;
 }
 
+Builder&
+Builder::setPluginName(const std::string& pluginName)
+{
+    Assert::getInstance().notEmpty(pluginName, "pluginName");
+
+    mPluginName = pluginName;
+
+    return *this;
+}
+
+Builder&
+Builder::useReaderInclusionFilter(const std::string& readerInclusionFilter)
+{
+    Assert::getInstance().notEmpty(
+        readerInclusionFilter, "readerInclusionFilter");
+
+    try {
+        mReaderInclusionFilterPattern = Pattern::compile(readerInclusionFilter);
+
+    } catch (const Exception& e) {
+        throw IllegalArgumentException(
+            "Bad regular expression.", std::make_shared<Exception>(e));
+    }
+
+    return *this;
+}
+
+Builder&
+Builder::useReaderExclusionFilter(const std::string& readerExclusionFilter)
+{
+    Assert::getInstance().notEmpty(
+        readerExclusionFilter, "readerExclusionFilter");
+
+    try {
+        mReaderExclusionFilterPattern = Pattern::compile(readerExclusionFilter);
+
+    } catch (const Exception& e) {
+        throw IllegalArgumentException(
+            "Bad regular expression.", std::make_shared<Exception>(e));
+    }
+
+    return *this;
+}
+
+Builder&
+Builder::setContextMode(const ContextMode contextMode)
+{
+    mContextMode = contextMode;
+
+    return *this;
+}
+
+Builder&
+Builder::useLazyInitialization()
+{
+    mIsLazyInitialization = true;
+
+    return *this;
+}
+
+Builder&
+Builder::useSpeculativeConnection()
+{
+    mIsSpeculativeConnection = true;
+
+    return *this;
+}
+
+Builder&
+Builder::useSessionReuse()
+{
+    mIsSessionReuse = true;
+
+    return *this;
+}
+
+Builder&
+Builder::useSharedAccessRetry(const int maxAttempts, const int maxBackoff)
+{
+    Assert::getInstance()
+        .greaterOrEqual(maxAttempts, 1, "maxAttempts")
+        .greaterOrEqual(maxBackoff, 0, "maxBackoff");
+
+    mSharedAccessMaxAttempts = maxAttempts;
+    mSharedAccessMaxBackoff = maxBackoff;
+
+    return *this;
+}
+
+Builder&
+Builder::useCrossProcessAccessLock()
+{
+    mIsCrossProcessAccessLock = true;
+
+    return *this;
+}
+
+Builder&
+Builder::useReaderCommandQueue(const int capacity)
+{
+    Assert::getInstance().greaterOrEqual(capacity, 1, "capacity");
+
+    mReaderCommandQueueCapacity = capacity;
+
+    return *this;
+}
+
+Builder&
+Builder::useReaderExecutor(const int threadCount)
+{
+    Assert::getInstance().greaterOrEqual(threadCount, 1, "threadCount");
+
+    mReaderExecutorThreadCount = threadCount;
+
+    return *this;
+}
+
+Builder&
+Builder::useReaderExecutor()
+{
+    const int threadCount
+        = static_cast<int>(std::thread::hardware_concurrency());
+
+    /* Zero when not computable */
+    return useReaderExecutor(threadCount > 0 ? threadCount : 1);
+}
+
+Builder&
+Builder::useAtrIdentificationDatabase(const std::string& path)
+{
+    Assert::getInstance().notEmpty(path, "path");
+
+    mAtrIdentificationIndex = PcscAtrIdentificationIndex::loadFromFile(path);
+
+    return *this;
+}
+
+Builder&
+Builder::useReaderCapabilityCache(const std::string& path)
+{
+    Assert::getInstance().notEmpty(path, "path");
+
+    mReaderCapabilityCache = std::make_shared<PcscReaderCapabilityCache>(path);
+
+    return *this;
+}
+
 std::shared_ptr<PcscPluginFactory>
 PcscPluginFactoryBuilder::Builder::build()
 {
-    return std::make_shared<PcscPluginFactoryAdapter>(
-            mContactlessReaderIdentificationFilterPattern,
-            mProtocolRulesMap,
-            mCardMonitoringCycleDuration);
+    PcscPluginFactoryAdapter::Configuration configuration;
+    configuration.contactlessReaderIdentificationFilterPattern
+        = mContactlessReaderIdentificationFilterPattern;
+    configuration.contactReaderIdentificationFilterPattern
+        = mContactReaderIdentificationFilterPattern;
+    configuration.protocolRulesMap = mProtocolRulesMap;
+    configuration.cardMonitoringCycleDuration = mCardMonitoringCycleDuration;
+    configuration.atrIdentificationIndex = mAtrIdentificationIndex;
+    configuration.contextMode = mContextMode;
+    configuration.isLazyInitialization = mIsLazyInitialization;
+    configuration.isSpeculativeConnection = mIsSpeculativeConnection;
+    configuration.isSessionReuse = mIsSessionReuse;
+    configuration.readerCommandQueueCapacity
+        = (mReaderExecutorThreadCount > 0 || mIsSpeculativeConnection)
+                  && mReaderCommandQueueCapacity == 0
+              ? DEFAULT_READER_COMMAND_QUEUE_CAPACITY
+              : mReaderCommandQueueCapacity;
+    configuration.readerExecutorThreadCount = mReaderExecutorThreadCount;
+    configuration.pluginName = mPluginName;
+    configuration.readerInclusionFilterPattern = mReaderInclusionFilterPattern;
+    configuration.readerExclusionFilterPattern = mReaderExclusionFilterPattern;
+    configuration.readerCapabilityCache = mReaderCapabilityCache;
+    configuration.accessCoordinator = std::make_shared<cpp::AccessCoordinator>(
+        mSharedAccessMaxAttempts,
+        mSharedAccessMaxBackoff,
+        mIsCrossProcessAccessLock);
+
+    return std::make_shared<PcscPluginFactoryAdapter>(configuration);
 }
 
 /* PCSC PLUGIN FACTORY BUILDER
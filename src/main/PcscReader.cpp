@@ -108,6 +108,31 @@ operator<<(std::ostream& os, const PcscReader::DisconnectionMode dm)
     return os;
 }
 
+/* PROTOCOL PREFERENCE ------------------------------------------------------ */
+
+std::ostream&
+operator<<(std::ostream& os, const PcscReader::ProtocolPreference pp)
+{
+    os << "PROTOCOL_PREFERENCE: ";
+
+    switch (pp) {
+    case PcscReader::ProtocolPreference::DRIVER:
+        os << "DRIVER";
+        break;
+    case PcscReader::ProtocolPreference::T1:
+        os << "T1";
+        break;
+    case PcscReader::ProtocolPreference::T0:
+        os << "T0";
+        break;
+    default:
+        os << "UNKNOWN";
+        break;
+    }
+
+    return os;
+}
+
 } /* namespace pcsc */
 } /* namespace plugin */
 } /* namespace keyple */
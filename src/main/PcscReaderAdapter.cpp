@@ -13,6 +13,11 @@
 
 #include "keyple/plugin/pcsc/PcscReaderAdapter.hpp"
 
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <thread>
+
 #if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
 #include <winscard.h>
 #else
@@ -30,9 +35,13 @@
 #include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
 #include "keyple/core/util/cpp/exception/InterruptedException.hpp"
 #include "keyple/plugin/pcsc/PcscPluginAdapter.hpp"
+#include "keyple/plugin/pcsc/PcscReaderProfile.hpp"
+#include "keyple/plugin/pcsc/cpp/exception/CardControlNotSupportedException.hpp"
 #include "keyple/plugin/pcsc/cpp/exception/CardException.hpp"
 #include "keyple/plugin/pcsc/cpp/exception/CardNotPresentException.hpp"
 
+#include "cpp/PcscUtils.hpp"
+
 namespace keyple {
 namespace plugin {
 namespace pcsc {
@@ -46,33 +55,71 @@ using keyple::core::util::cpp::exception::Exception;
 using keyple::core::util::cpp::exception::IllegalArgumentException;
 using keyple::core::util::cpp::exception::IllegalStateException;
 using keyple::core::util::cpp::exception::InterruptedException;
+using keyple::plugin::pcsc::cpp::exception::CardControlNotSupportedException;
 using keyple::plugin::pcsc::cpp::exception::CardException;
 using keyple::plugin::pcsc::cpp::exception::CardNotPresentException;
 
+namespace {
+
+/**
+ * Error reported to the callbacks of the operations abandoned by a stopped
+ * command queue.
+ */
+std::exception_ptr
+abandonmentError()
+{
+    return std::make_exception_ptr(
+        IllegalStateException("Reader command queue stopped"));
+}
+
+} /* namespace */
+
+const int PcscReaderAdapter::CM_IOCTL_GET_FEATURE_REQUEST_COMMAND_ID = 3400;
+
 PcscReaderAdapter::PcscReaderAdapter(
     std::shared_ptr<CardTerminal> terminal,
     std::shared_ptr<PcscPluginAdapter> pluginAdapter,
     const int cardMonitoringCycleDuration)
 : mIsInitialized(false)
-, mIsPhysicalChannelOpen(false)
+, mState(State::IDLE)
+, mStateWaiterCount(0)
 , mTerminal(terminal)
 , mName(terminal->getName())
+, mDeviceName(PcscReaderProfile::getDeviceName(terminal->getName()))
 , mPluginAdapter(pluginAdapter)
 , mCardMonitoringCycleDuration(cardMonitoringCycleDuration)
 , mPingApdu(HexUtil::toByteArray("00C0000000")) // GET RESPONSE
 , mIsContactless(false)
 , mProtocol(IsoProtocol::ANY.getValue())
+, mShareMode(SCARD_SHARE_SHARED)
+, mPreferredProtocols(SCARD_PROTOCOL_ANY)
+, mIsProtocolResolved(true)
+, mProtocolPreference(ProtocolPreference::DRIVER)
 , mIsModeExclusive(false)
 , mDisconnectionMode(keyple::plugin::pcsc::PcscReader::DisconnectionMode::RESET)
 , mLoopWaitCard(false)
 , mLoopWaitCardRemoval(false)
 , mIsObservationActive(false)
+, mCardInsertionTime(0)
+, mParkedCardEventCount(0)
+, mDirectCardReuseCount(0)
+, mTransactionLock(std::make_shared<PcscReaderTransactionAdapter::Lock>())
 {
 #if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
     mIsWindows = true;
 #else
     mIsWindows = false;
 #endif
+
+    const int commandQueueCapacity
+        = pluginAdapter->getReaderCommandQueueCapacity();
+    if (commandQueueCapacity > 0) {
+        mCommandQueue = std::unique_ptr<PcscReaderCommandQueue>(
+            new PcscReaderCommandQueue(
+                mName,
+                commandQueueCapacity,
+                pluginAdapter->getReaderExecutor()));
+    }
 }
 
 void
@@ -91,6 +138,18 @@ PcscReaderAdapter::waitForCardInsertion()
             if (mTerminal->waitForCardPresent(mCardMonitoringCycleDuration)) {
                 /* Card inserted */
                 mLogger->trace("Reader [%]: card inserted\n", getName());
+                mCardInsertionTime
+                    = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+
+                const State state = acquireState(State::CONNECTING, false);
+                StateGuard guard(*this, state);
+                if (state != State::CONNECTED) {
+                    guard.setNext(State::PRESENT);
+                    startSpeculativeConnection();
+                }
+
                 return;
             }
 
@@ -166,6 +225,12 @@ PcscReaderAdapter::isCurrentProtocol(const std::string& readerProtocol) const
      * C++ specific: getProtocolRule throws when protocol not found instead of
      * returning null.
      */
+    if (acquireState(State::PROCESSING, true) != State::CONNECTED) {
+        return false;
+    }
+
+    StateGuard guard(*this, State::CONNECTED);
+
     try {
         bool isCurrentProtocol = false;
 
@@ -207,7 +272,29 @@ PcscReaderAdapter::getName() const
 void
 PcscReaderAdapter::openPhysicalChannel()
 {
+    if (mCommandQueue != nullptr && !mCommandQueue->isWorkerThread()) {
+        mCommandQueue->call<void>([this]() { openPhysicalChannel(); });
+        return;
+    }
+
+    StateGuard guard(*this, acquireState(State::CONNECTING, false));
+
+    if (mCard != nullptr && mCard->isStale()) {
+        /*
+         * The PC/SC context has been re-established since the card was
+         * connected, its handle is no longer usable: connect again.
+         */
+        mLogger->debug(
+            "Reader [%]: card handle bound to a former PC/SC context, "
+            "reconnecting\n",
+            getName());
+        resetContext();
+        guard.setNext(State::PRESENT);
+    }
+
     if (mCard != nullptr) {
+        mChannel = mCard->getBasicChannel();
+        guard.setNext(State::CONNECTED);
         return;
     }
 
@@ -221,7 +308,22 @@ PcscReaderAdapter::openPhysicalChannel()
             getName(),
             mProtocol);
 
-        mCard = mTerminal->connect(mProtocol);
+        mCard = takeParkedCard();
+        if (mCard == nullptr) {
+            mCard = takeSpeculativeCard();
+        }
+
+        if (mCard == nullptr) {
+            /* Some platforms grant exclusive access to direct connections */
+            releaseDirectConnection();
+            mCard = connect(
+                mTerminal,
+                mProtocol,
+                mIsProtocolResolved,
+                mShareMode,
+                mPreferredProtocols,
+                mProtocolPreference);
+        }
         if (mIsModeExclusive) {
             mCard->beginExclusive();
             mLogger->debug(
@@ -235,6 +337,14 @@ PcscReaderAdapter::openPhysicalChannel()
         }
 
         mChannel = mCard->getBasicChannel();
+        guard.setNext(State::CONNECTED);
+
+        mLogger->debug(
+            "Reader [%]: card connected with protocol [%]\n",
+            getName(),
+            mCard->getProtocol());
+
+        mPluginAdapter->validateReaderProfile(getName(), mCard);
 
     } catch (const CardNotPresentException& e) {
         throw CardIOException(
@@ -250,23 +360,131 @@ PcscReaderAdapter::openPhysicalChannel()
 void
 PcscReaderAdapter::closePhysicalChannel()
 {
+    if (mCommandQueue != nullptr && !mCommandQueue->isWorkerThread()) {
+        mCommandQueue->call<void>([this]() { closePhysicalChannel(); });
+        return;
+    }
+
     /*
      * If the reader is observed, the actual disconnection will be done in the
      * card removal sequence.
      */
     if (!mIsObservationActive) {
-        disconnect();
+        const State state = acquireState(State::REMOVING, false);
+        StateGuard guard(*this, state);
+
+        if (mPluginAdapter->isSessionReuse() && mCard != nullptr) {
+            parkCard();
+        } else {
+            disconnectCard();
+        }
+
+        guard.setNext(state == State::IDLE ? State::IDLE : State::PRESENT);
+    }
+}
+
+void
+PcscReaderAdapter::parkCard()
+{
+    try {
+        const DWORD state = mTerminal->getState();
+        if ((state & SCARD_STATE_PRESENT) != 0 && !mCard->isStale()) {
+            if (mIsModeExclusive) {
+                mCard->endExclusive();
+            }
+
+            mParkedCard = mCard;
+            mParkedCardEventCount = state >> 16;
+            mChannel = nullptr;
+            resetContext();
+
+            mLogger->trace(
+                "Reader [%]: connection kept for the next session\n",
+                getName());
+            return;
+        }
+
+    } catch (const CardException& /*e*/) {
+        /* The card is disconnected below */
+    }
+
+    disconnectCard();
+}
+
+std::shared_ptr<Card>
+PcscReaderAdapter::takeParkedCard()
+{
+    const std::shared_ptr<Card> card = mParkedCard;
+    mParkedCard = nullptr;
+
+    if (card == nullptr || card->isStale()) {
+        return nullptr;
+    }
+
+    try {
+        /* The event counter changes on each card removal or insertion */
+        const DWORD state = mTerminal->getState();
+        if ((state & SCARD_STATE_PRESENT) != 0
+            && (state >> 16) == mParkedCardEventCount) {
+            mLogger->trace(
+                "Reader [%]: reuse of the connection kept from the previous "
+                "session\n",
+                getName());
+            return card;
+        }
+
+    } catch (const CardException& /*e*/) {
+        /* The card is disconnected below */
     }
+
+    mLogger->trace(
+        "Reader [%]: card changed since the previous session\n", getName());
+    card->disconnect(static_cast<DWORD>(SCARD_LEAVE_CARD));
+
+    return nullptr;
 }
 
 void PcscReaderAdapter::disconnect()
 {
+    StateGuard guard(*this, acquireState(State::REMOVING, false));
+    guard.setNext(State::IDLE);
+
+    try {
+        disconnectCard();
+
+    } catch (const Exception&) {
+        /* The handle is not kept, the card being considered as gone */
+        resetContext();
+        throw;
+    }
+}
+
+void PcscReaderAdapter::disconnectCard()
+{
+    /* The connection kept from the previous session is released as well */
+    if (mCard == nullptr) {
+        mCard = mParkedCard;
+    }
+
+    mParkedCard = nullptr;
+
+    /* A connection not used by the application is simply released */
+    const std::shared_ptr<Card> speculativeCard = takeSpeculativeCard();
+    if (speculativeCard != nullptr) {
+        speculativeCard->disconnect(static_cast<DWORD>(SCARD_LEAVE_CARD));
+    }
+
+    logProtocolUsage();
+
     try {
         if (mCard != nullptr) {
-            /* Disconnect using the extended mode allowing UNPOWER. */
-            mCard->disconnect(getDisposition(mDisconnectionMode));
-            /* Reset the reader state to avoid bad card detection next time. */
-            resetReaderState();
+            if (mDisconnectionMode == DisconnectionMode::UNPOWER) {
+                /* Reset the reader state to avoid bad card detection next time. */
+                resetReaderState();
+
+            } else {
+                mCard->disconnect(getDisposition(mDisconnectionMode));
+            }
         }
 
     } catch (const CardNotPresentException& e) {
@@ -282,7 +500,7 @@ void PcscReaderAdapter::disconnect()
     resetContext();
 }
 
-int PcscReaderAdapter::getDisposition(const DisconnectionMode mode)
+DWORD PcscReaderAdapter::getDisposition(const DisconnectionMode mode)
 {
     switch (mode) {
     case DisconnectionMode::RESET:
@@ -298,22 +516,198 @@ int PcscReaderAdapter::getDisposition(const DisconnectionMode mode)
     }
 }
 
-void PcscReaderAdapter::resetReaderState()
+void
+PcscReaderAdapter::resolveProtocol()
 {
     try {
-        if (mDisconnectionMode == DisconnectionMode::UNPOWER) {
-            mTerminal->connect("*")->disconnect(false);
+        CardTerminal::getConnectionParameters(
+            mProtocol, mShareMode, mPreferredProtocols);
+        mIsProtocolResolved = true;
+
+    } catch (const IllegalArgumentException& /*e*/) {
+        mIsProtocolResolved = false;
+    }
+}
+
+std::shared_ptr<Card>
+PcscReaderAdapter::connect(
+    const std::shared_ptr<CardTerminal>& terminal,
+    const std::string& protocol,
+    const bool isResolved,
+    const DWORD shareMode,
+    const DWORD preferredProtocols,
+    const ProtocolPreference preference)
+{
+    if (!isResolved) {
+        return terminal->connect(protocol);
+    }
+
+    if (preferredProtocols != SCARD_PROTOCOL_ANY
+        || preference == ProtocolPreference::DRIVER) {
+        return terminal->connect(shareMode, preferredProtocols);
+    }
+
+    /* The ATR is known before connecting, from the reader state */
+    std::vector<uint8_t> atr;
+    terminal->getState(atr);
+
+    DWORD defaultProtocol;
+    const DWORD offeredProtocols = getOfferedProtocols(atr, defaultProtocol);
+    const DWORD preferredProtocol = preference == ProtocolPreference::T1
+                                        ? SCARD_PROTOCOL_T1
+                                        : SCARD_PROTOCOL_T0;
+
+    if (!atr.empty() && (offeredProtocols & preferredProtocol) != 0) {
+        return terminal->connect(shareMode, preferredProtocol);
+    }
+
+    return terminal->connect(shareMode, preferredProtocols);
+}
+
+DWORD
+PcscReaderAdapter::getOfferedProtocols(
+    const std::vector<uint8_t>& atr, DWORD& defaultProtocol)
+{
+    /* Without TD1, only T=0 is offered (ISO7816-3, 8.2.3) */
+    defaultProtocol = SCARD_PROTOCOL_T0;
+    DWORD offeredProtocols = 0;
+
+    if (atr.size() < 2) {
+        return SCARD_PROTOCOL_T0;
+    }
+
+    size_t pos = 2;
+    uint8_t y = atr[1] & 0xF0;
+    int level = 1;
+    int specificProtocol = -1;
+
+    while (true) {
+        if ((y & 0x10) != 0) {
+            /* TA2 present: specific mode, the protocol is imposed */
+            if (level == 2 && pos < atr.size()) {
+                specificProtocol = atr[pos] & 0x0F;
+            }
+            pos++;
         }
+        if ((y & 0x20) != 0) {
+            pos++;
+        }
+        if ((y & 0x40) != 0) {
+            pos++;
+        }
+        if ((y & 0x80) == 0 || pos >= atr.size()) {
+            break;
+        }
+
+        const uint8_t td = atr[pos++];
+        const int t = td & 0x0F;
+        if (t == 0) {
+            offeredProtocols |= SCARD_PROTOCOL_T0;
+        } else if (t == 1) {
+            offeredProtocols |= SCARD_PROTOCOL_T1;
+        }
+        if (level == 1 && t == 1) {
+            defaultProtocol = SCARD_PROTOCOL_T1;
+        }
+
+        y = td & 0xF0;
+        level++;
+    }
+
+    if (specificProtocol == 0 || specificProtocol == 1) {
+        defaultProtocol = specificProtocol == 1 ? SCARD_PROTOCOL_T1
+                                                : SCARD_PROTOCOL_T0;
+        return defaultProtocol;
+    }
+
+    return offeredProtocols != 0 ? offeredProtocols : SCARD_PROTOCOL_T0;
+}
+
+void
+PcscReaderAdapter::logProtocolUsage() const
+{
+    if (mCard == nullptr || mChannel == nullptr) {
+        return;
+    }
+
+    DWORD defaultProtocol;
+    getOfferedProtocols(mCard->getATR(), defaultProtocol);
+
+    /* With T=0, each case 4 command would have required a GET RESPONSE */
+    const uint64_t avoided = mCard->mProtocol == SCARD_PROTOCOL_T1
+                                     && defaultProtocol == SCARD_PROTOCOL_T0
+                                 ? mChannel->getCase4CommandCount()
+                                 : 0;
+
+    mLogger->debug(
+        "Reader [%]: protocol [%], % GET RESPONSE exchange(s) issued, % "
+        "avoided\n",
+        getName(),
+        mCard->getProtocol(),
+        mChannel->getGetResponseCount(),
+        avoided);
+}
+
+void PcscReaderAdapter::resetReaderState()
+{
+    try {
+        mCard->reconnect(static_cast<DWORD>(SCARD_UNPOWER_CARD));
 
     } catch (const CardException& /*e*/) {
         /* NOP */
     }
+
+    mCard->disconnect(static_cast<DWORD>(SCARD_LEAVE_CARD));
+}
+
+void
+PcscReaderAdapter::resetCard(const DWORD initialization, const std::string& type)
+{
+    if (acquireState(State::PROCESSING, true) != State::CONNECTED) {
+        throw IllegalStateException(getName() + ": no card connected");
+    }
+
+    StateGuard guard(*this, State::CONNECTED);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    try {
+        mCard->reconnect(initialization);
+
+    } catch (const CardException& e) {
+        throw IllegalStateException(
+            "Reader failure.", std::make_shared<CardException>(e));
+    }
+
+    mLogger->debug(
+        "Reader [%]: % reset done in % us, ATR: %, protocol: %\n",
+        getName(),
+        type,
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count(),
+        HexUtil::toHex(mCard->getATR()),
+        mCard->getProtocol());
+}
+
+void
+PcscReaderAdapter::warmReset()
+{
+    resetCard(SCARD_RESET_CARD, "warm");
+}
+
+void
+PcscReaderAdapter::coldReset()
+{
+    resetCard(SCARD_UNPOWER_CARD, "cold");
 }
 
 bool
 PcscReaderAdapter::isPhysicalChannelOpen() const
 {
-    return mIsPhysicalChannelOpen;
+    const State state = mState.load();
+
+    return state == State::CONNECTED || state == State::PROCESSING;
 }
 
 bool
@@ -332,6 +726,78 @@ PcscReaderAdapter::checkCardPresence()
     }
 }
 
+void
+PcscReaderAdapter::startSpeculativeConnection()
+{
+    /* The speculative connection implies a command queue (see the builder) */
+    if (!mPluginAdapter->isSpeculativeConnection() || mCommandQueue == nullptr
+        || mCard != nullptr || mSpeculativeCard.valid()) {
+        return;
+    }
+
+    releaseDirectConnection();
+
+    const std::shared_ptr<CardTerminal> terminal = mTerminal;
+    const std::string protocol = mProtocol;
+    const bool isResolved = mIsProtocolResolved;
+    const DWORD shareMode = mShareMode;
+    const DWORD preferredProtocols = mPreferredProtocols;
+    const ProtocolPreference preference = mProtocolPreference;
+
+    const std::function<std::shared_ptr<Card>()> operation =
+        [terminal,
+         protocol,
+         isResolved,
+         shareMode,
+         preferredProtocols,
+         preference]() {
+            return connect(
+                terminal,
+                protocol,
+                isResolved,
+                shareMode,
+                preferredProtocols,
+                preference);
+        };
+
+    /*
+     * The connection is made by the worker of the reader, in parallel with
+     * the insertion event: no thread is created per insertion, and so no
+     * PC/SC context in the per-thread context mode.
+     */
+    try {
+        mSpeculativeCard
+            = mCommandQueue->submit<std::shared_ptr<Card>>(operation, false);
+
+    } catch (const IllegalStateException&) {
+        /* Queue full, the card will be connected on demand */
+    }
+}
+
+std::shared_ptr<Card>
+PcscReaderAdapter::takeSpeculativeCard()
+{
+    if (!mSpeculativeCard.valid()) {
+        return nullptr;
+    }
+
+    try {
+        return mSpeculativeCard.get();
+
+    } catch (const Exception& e) {
+        /* The card may have been removed meanwhile, connect again if needed */
+        mLogger->debug(
+            "Reader [%]: speculative connection failed: %\n",
+            getName(),
+            e.getMessage());
+
+    } catch (const std::future_error&) {
+        /* Abandoned by the command queue */
+    }
+
+    return nullptr;
+}
+
 void
 PcscReaderAdapter::closePhysicalChannelSafely()
 {
@@ -347,58 +813,122 @@ void
 PcscReaderAdapter::resetContext()
 {
     mCard = nullptr;
-    mIsPhysicalChannelOpen = false;
+    mChannel = nullptr;
+}
+
+PcscReaderAdapter::State
+PcscReaderAdapter::acquireState(
+    const State target, const bool isConnectedRequired) const
+{
+    const auto isTransient = [](const State state) {
+        return state == State::CONNECTING || state == State::PROCESSING
+               || state == State::REMOVING;
+    };
+
+    State state = mState.load();
+
+    for (;;) {
+        if (isTransient(state)) {
+            /*
+             * Registered as waiter before checking the state again, so that
+             * the StateGuard of the owner either is seen done or notifies.
+             */
+            std::unique_lock<std::mutex> lock(mStateMutex);
+            mStateWaiterCount++;
+            mStateChanged.wait(lock, [this, &state, &isTransient]() {
+                state = mState.load();
+                return !isTransient(state);
+            });
+            mStateWaiterCount--;
+
+        } else if (isConnectedRequired && state != State::CONNECTED) {
+            return state;
+
+        } else if (mState.compare_exchange_weak(state, target)) {
+            return state;
+        }
+    }
 }
 
 const std::string
 PcscReaderAdapter::getPowerOnData() const
 {
+    if (acquireState(State::PROCESSING, true) != State::CONNECTED) {
+        throw IllegalStateException(getName() + ": no card connected");
+    }
+
+    StateGuard guard(*this, State::CONNECTED);
+
     return HexUtil::toHex(mCard->getATR());
 }
 
 const std::vector<uint8_t>
 PcscReaderAdapter::transmitApdu(const std::vector<uint8_t>& apduCommandData)
 {
-    std::vector<uint8_t> apduResponseData;
+    waitForTransaction();
 
-    if (mChannel) {
-        try {
-            apduResponseData = mChannel->transmit(apduCommandData);
+    if (mCommandQueue != nullptr && !mCommandQueue->isWorkerThread()) {
+        return mCommandQueue->call<std::vector<uint8_t>>(
+            [this, &apduCommandData]() {
+                return transmitApdu(apduCommandData);
+            });
+    }
 
-        } catch (const CardNotPresentException& e) {
-            throw CardIOException(
-                mName + ": " + e.getMessage(),
-                std::make_shared<CardNotPresentException>(e));
+    if (acquireState(State::PROCESSING, true) != State::CONNECTED) {
+        /* Could occur if the card was removed */
+        throw CardIOException(getName() + ": null channel.");
+    }
 
-        } catch (const CardException& e) {
-            if (e.getMessage().find("CARD") != std::string::npos ||
-                e.getMessage().find("NOT_TRANSACTED") != std::string::npos ||
-                e.getMessage().find("INVALID_ATR") != std::string::npos) {
-                throw CardIOException(
-                    getName() + ":" + e.getMessage(),
-                    std::make_shared<CardException>(e));
-            } else {
-                throw ReaderIOException(
-                    getName() + ":" + e.getMessage(),
-                    std::make_shared<CardException>(e));
-            }
+    StateGuard guard(*this, State::CONNECTED);
 
-        } catch (const IllegalStateException& e) {
-            /* Card could have been removed prematurely */
-            throw CardIOException(
-                getName() + ":" + e.getMessage(),
-                std::make_shared<IllegalStateException>(e.getMessage()));
+    std::vector<uint8_t> apduResponseData;
+
+    try {
+        apduResponseData = mChannel->transmit(apduCommandData);
+
+        const int64_t insertionTime = mCardInsertionTime.exchange(0);
+        if (insertionTime != 0) {
+            const int64_t now
+                = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch())
+                      .count();
+            mLogger->debug(
+                "Reader [%]: first response % us after card insertion "
+                "(speculative connection: %)\n",
+                getName(),
+                (now - insertionTime) / 1000,
+                mPluginAdapter->isSpeculativeConnection());
+        }
+
+    } catch (const CardNotPresentException& e) {
+        throw CardIOException(
+            mName + ": " + e.getMessage(),
+            std::make_shared<CardNotPresentException>(e));
 
-        } catch (const IllegalArgumentException& e) {
-            /* Card could have been removed prematurely */
+    } catch (const CardException& e) {
+        if (e.getMessage().find("CARD") != std::string::npos ||
+            e.getMessage().find("NOT_TRANSACTED") != std::string::npos ||
+            e.getMessage().find("INVALID_ATR") != std::string::npos) {
             throw CardIOException(
                 getName() + ":" + e.getMessage(),
-                std::make_shared<IllegalStateException>(e.getMessage()));
+                std::make_shared<CardException>(e));
+        } else {
+            throw ReaderIOException(
+                getName() + ":" + e.getMessage(),
+                std::make_shared<CardException>(e));
         }
 
-    } else {
-        /* Could occur if the card was removed */
-        throw CardIOException(getName() + ": null channel.");
+    } catch (const IllegalStateException& e) {
+        /* Card could have been removed prematurely */
+        throw CardIOException(
+            getName() + ":" + e.getMessage(),
+            std::make_shared<IllegalStateException>(e.getMessage()));
+
+    } catch (const IllegalArgumentException& e) {
+        /* Card could have been removed prematurely */
+        throw CardIOException(
+            getName() + ":" + e.getMessage(),
+            std::make_shared<IllegalStateException>(e.getMessage()));
     }
 
     return apduResponseData;
@@ -413,7 +943,9 @@ PcscReaderAdapter::isContactless()
          * determined or fixed explicitly, let's ask the plugin to determine it
          * (only once)
          */
-        mIsContactless = mPluginAdapter->isContactless(getName());
+        mIsContactless
+            = mPluginAdapter->getReaderProfile(getName())->isContactless();
+        mIsInitialized = true;
     }
 
     return mIsContactless;
@@ -544,7 +1076,9 @@ PcscReaderAdapter::setSharingMode(const SharingMode sharingMode)
 
     if (sharingMode == SharingMode::SHARED) {
         /* If a card is present, change the mode immediately */
-        if (mCard != nullptr) {
+        if (acquireState(State::PROCESSING, true) == State::CONNECTED) {
+            StateGuard guard(*this, State::CONNECTED);
+
             try {
                 mCard->endExclusive();
 
@@ -585,7 +1119,35 @@ PcscReaderAdapter::setIsoProtocol(const IsoProtocol& isoProtocol)
         isoProtocol,
         isoProtocol.getValue());
 
+    const bool isChanged = mProtocol != isoProtocol.getValue();
     mProtocol = isoProtocol.getValue();
+    resolveProtocol();
+
+    if (isChanged
+        && acquireState(State::PROCESSING, true) == State::CONNECTED) {
+        StateGuard guard(*this, State::CONNECTED);
+
+        /* Renegotiate the protocol on the existing connection */
+        if (!mIsProtocolResolved) {
+            /* Throws the IllegalArgumentException describing the issue */
+            CardTerminal::getConnectionParameters(
+                mProtocol, mShareMode, mPreferredProtocols);
+        }
+
+        try {
+            mCard->reconnect(
+                mShareMode, mPreferredProtocols, SCARD_RESET_CARD);
+
+        } catch (const CardException& e) {
+            throw IllegalStateException(
+                "Reader failure.", std::make_shared<CardException>(e));
+        }
+
+        mLogger->debug(
+            "Reader [%]: protocol renegotiated: %\n",
+            getName(),
+            mCard->getProtocol());
+    }
 
     return *this;
 }
@@ -604,24 +1166,74 @@ PcscReaderAdapter::setDisconnectionMode(
     return *this;
 }
 
+PcscReader&
+PcscReaderAdapter::setProtocolPreference(
+    const ProtocolPreference protocolPreference)
+{
+    mLogger->trace(
+        "Reader [%]: set protocol preference to [%]\n",
+        getName(),
+        protocolPreference);
+
+    mProtocolPreference = protocolPreference;
+
+    return *this;
+}
+
 const std::vector<uint8_t>
 PcscReaderAdapter::transmitControlCommand(
     const int commandId, const std::vector<uint8_t>& command)
 {
+    waitForTransaction();
+
+    if (mCommandQueue != nullptr && !mCommandQueue->isWorkerThread()) {
+        return mCommandQueue->call<std::vector<uint8_t>>(
+            [this, commandId, &command]() {
+                return transmitControlCommand(commandId, command);
+            });
+    }
+
     std::vector<uint8_t> response;
     const int controlCode
         = mIsWindows ? 0x00310000 | (commandId << 2) : 0x42000000 | commandId;
 
     try {
-        if (mCard != nullptr) {
+        if (acquireState(State::PROCESSING, true) == State::CONNECTED) {
+            StateGuard guard(*this, State::CONNECTED);
 
             response = mCard->transmitControlCommand(controlCode, command);
         } else {
-            std::shared_ptr<Card> virtualCard = mTerminal->connect("DIRECT");
-            response = virtualCard->transmitControlCommand(controlCode, command);
-            virtualCard->disconnect(false);
+            std::lock_guard<std::mutex> lock(mDirectCardMutex);
+
+            bool isReused;
+            std::shared_ptr<Card> virtualCard = getDirectCard(isReused);
+
+            try {
+                response
+                    = virtualCard->transmitControlCommand(controlCode, command);
+
+            } catch (const CardException& e) {
+                /* The connection may have been lost, retry once on a new one */
+                releaseDirectCard();
+                if (!isReused) {
+                    throw;
+                }
+
+                virtualCard = getDirectCard(isReused);
+                response
+                    = virtualCard->transmitControlCommand(controlCode, command);
+            }
+
+            if (isReused) {
+                mDirectCardReuseCount++;
+            }
         }
 
+    } catch (const CardControlNotSupportedException& e) {
+        throw IllegalStateException(
+            "Reader failure.",
+            std::make_shared<CardControlNotSupportedException>(e));
+
     } catch (const CardException& e) {
         throw IllegalStateException(
             "Reader failure.", std::make_shared<CardException>(e));
@@ -630,12 +1242,436 @@ PcscReaderAdapter::transmitControlCommand(
     return response;
 }
 
+std::shared_ptr<Card>
+PcscReaderAdapter::getDirectCard(bool& isReused)
+{
+    if (mDirectCard != nullptr && mDirectCard->isStale()) {
+        /* Bound to a former PC/SC context, the handle is no longer usable */
+        mDirectCard = nullptr;
+    }
+
+    isReused = mDirectCard != nullptr;
+
+    if (!isReused) {
+        mDirectCard = mTerminal->connect(
+            static_cast<DWORD>(SCARD_SHARE_DIRECT), 0);
+        mPluginAdapter->validateReaderProfile(getName(), mDirectCard);
+    }
+
+    return mDirectCard;
+}
+
+void
+PcscReaderAdapter::releaseDirectCard()
+{
+    if (mDirectCard == nullptr) {
+        return;
+    }
+
+    mDirectCard->disconnect(false);
+    mDirectCard = nullptr;
+
+    mLogger->debug(
+        "Reader [%]: direct connection released, % connection(s) saved so "
+        "far\n",
+        getName(),
+        mDirectCardReuseCount);
+}
+
+const std::shared_ptr<CardTerminal>&
+PcscReaderAdapter::getTerminal() const
+{
+    return mTerminal;
+}
+
+void
+PcscReaderAdapter::releaseDirectConnection()
+{
+    std::lock_guard<std::mutex> lock(mDirectCardMutex);
+
+    releaseDirectCard();
+}
+
+const std::map<uint8_t, int>
+PcscReaderAdapter::getFeatures()
+{
+    const std::shared_ptr<PcscReaderProfile> profile
+        = mPluginAdapter->getReaderProfile(getName());
+
+    if (!profile->isFeaturesKnown()) {
+        std::vector<uint8_t> features;
+        try {
+            features = transmitControlCommand(
+                CM_IOCTL_GET_FEATURE_REQUEST_COMMAND_ID, std::vector<uint8_t>());
+
+        } catch (const IllegalStateException& e) {
+            if (std::dynamic_pointer_cast<CardControlNotSupportedException>(
+                    e.getCause())
+                == nullptr) {
+                /* Transient failure, the features remain unknown */
+                mLogger->debug(
+                    "Reader [%]: features not retrieved: %\n",
+                    getName(),
+                    e.getMessage());
+
+                return std::map<uint8_t, int>();
+            }
+
+            /* Readers without PC/SC part 10 support reject the request */
+            mLogger->debug(
+                "Reader [%]: features not supported\n", getName());
+        }
+
+        profile->setFeatures(features);
+        mPluginAdapter->storeReaderProfile(profile);
+    }
+
+    /* TLV list: tag (1 byte), length (1 byte, 4), control code (big endian) */
+    std::map<uint8_t, int> features;
+    const std::vector<uint8_t> tlv = profile->getFeatures();
+    size_t i = 0;
+    while (i + 2 <= tlv.size() && i + 2 + tlv[i + 1] <= tlv.size()) {
+        if (tlv[i + 1] == 4) {
+            const uint32_t controlCode
+                = (static_cast<uint32_t>(tlv[i + 2]) << 24)
+                  | (static_cast<uint32_t>(tlv[i + 3]) << 16)
+                  | (static_cast<uint32_t>(tlv[i + 4]) << 8) | tlv[i + 5];
+            features[tlv[i]] = getCommandId(controlCode);
+        }
+
+        i += 2 + tlv[i + 1];
+    }
+
+    return features;
+}
+
+std::unique_ptr<PcscReaderTransaction>
+PcscReaderAdapter::beginTransaction(const int timeout)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    {
+        std::unique_lock<std::mutex> lock(mTransactionLock->mutex);
+        if (!mTransactionLock->released.wait_for(
+                lock, std::chrono::milliseconds(timeout), [this]() {
+                    return mTransactionLock->owner.load() == std::thread::id();
+                })) {
+            throw IllegalStateException(
+                getName() + ": timeout while waiting for the transaction");
+        }
+
+        /* Released by the transaction, or below on failure */
+        mTransactionLock->owner.store(std::this_thread::get_id());
+    }
+
+    /* In exclusive mode, the card is already held by a PC/SC transaction */
+    const bool isPcscTransaction = !mIsModeExclusive;
+
+    /*
+     * The card is taken, and its PC/SC transaction begun, without leaving the
+     * PROCESSING state so that it can not be released meanwhile.
+     */
+    std::shared_ptr<Card> card;
+    uint64_t binding = 0;
+    try {
+        if (acquireState(State::PROCESSING, true) == State::CONNECTED) {
+            StateGuard guard(*this, State::CONNECTED);
+            card = mCard;
+            binding = card->getBinding();
+
+            if (isPcscTransaction) {
+                try {
+                    card->beginExclusive();
+
+                } catch (const CardException& e) {
+                    throw IllegalStateException(
+                        "Couldn't begin the transaction",
+                        std::make_shared<CardException>(e));
+                }
+            }
+        }
+
+        if (card == nullptr) {
+            throw IllegalStateException(getName() + ": no card connected");
+        }
+
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mTransactionLock->mutex);
+            mTransactionLock->owner.store(std::thread::id());
+        }
+
+        mTransactionLock->released.notify_all();
+        throw;
+    }
+
+    mLogger->trace(
+        "Reader [%]: transaction begun in % us\n",
+        getName(),
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+
+    std::function<void()> endExclusive;
+    if (isPcscTransaction) {
+        endExclusive = [this, card, binding]() {
+            endTransaction(card, binding);
+        };
+    }
+
+    return std::unique_ptr<PcscReaderTransaction>(
+        new PcscReaderTransactionAdapter(endExclusive, mTransactionLock));
+}
+
+void
+PcscReaderAdapter::endTransaction(
+    const std::shared_ptr<Card> card, const uint64_t binding)
+{
+    /* Same transition as the commands, so that the card is not rebound */
+    const State state = acquireState(State::PROCESSING, false);
+    StateGuard guard(*this, state);
+
+    if (card->isDisconnected() || card->getBinding() != binding) {
+        return;
+    }
+
+    try {
+        card->endExclusive();
+
+    } catch (const CardException& e) {
+        throw IllegalStateException(
+            "Couldn't end the transaction", std::make_shared<CardException>(e));
+    }
+}
+
+int
+PcscReaderAdapter::getCommandId(const uint32_t controlCode) const
+{
+    /* Reverse of the conversion done by transmitControlCommand */
+    return mIsWindows ? static_cast<int>((controlCode - 0x00310000) >> 2)
+                      : static_cast<int>(controlCode - 0x42000000);
+}
+
 int
 PcscReaderAdapter::getIoctlCcidEscapeCommandId() const
 {
     return mIsWindows ? 3500 : 1;
 }
 
+const std::string&
+PcscReaderAdapter::getDeviceName() const
+{
+    return mDeviceName;
+}
+
+const std::vector<std::string>
+PcscReaderAdapter::getDeviceReaderNames() const
+{
+    return mPluginAdapter->getDeviceReaderNames(mDeviceName);
+}
+
+void
+PcscReaderAdapter::waitForTransaction()
+{
+    const std::thread::id owner = mTransactionLock->owner.load();
+    if (owner == std::thread::id() || owner == std::this_thread::get_id()
+        || (mCommandQueue != nullptr && mCommandQueue->isWorkerThread())) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mTransactionLock->mutex);
+    mTransactionLock->released.wait(lock, [this]() {
+        return mTransactionLock->owner.load() == std::thread::id();
+    });
+}
+
+void
+PcscReaderAdapter::checkTransactionOwnership() const
+{
+    const std::thread::id owner = mTransactionLock->owner.load();
+    if (owner != std::thread::id() && owner != std::this_thread::get_id()) {
+        throw IllegalStateException(
+            getName() + ": transaction of another thread in progress");
+    }
+}
+
+PcscReaderCommandQueue&
+PcscReaderAdapter::getCommandQueue()
+{
+    if (mCommandQueue == nullptr) {
+        throw IllegalStateException(
+            getName() + ": no command queue, see useReaderCommandQueue()");
+    }
+
+    return *mCommandQueue;
+}
+
+std::future<std::vector<uint8_t>>
+PcscReaderAdapter::transmitApduAsync(const std::vector<uint8_t>& apdu)
+{
+    checkTransactionOwnership();
+
+    return getCommandQueue().submit<std::vector<uint8_t>>(
+        [this, apdu]() { return transmitApdu(apdu); }, false);
+}
+
+void
+PcscReaderAdapter::transmitApduAsync(
+    const std::vector<uint8_t>& apdu, const DataCallback& callback)
+{
+    checkTransactionOwnership();
+
+    getCommandQueue().execute(
+        [this, apdu, callback]() {
+            std::vector<uint8_t> response;
+            std::exception_ptr error;
+            try {
+                response = transmitApdu(apdu);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            callback(response, error);
+        },
+        [callback]() { callback(std::vector<uint8_t>(), abandonmentError()); },
+        false);
+}
+
+std::future<std::vector<uint8_t>>
+PcscReaderAdapter::transmitControlCommandAsync(
+    const int commandId, const std::vector<uint8_t>& command)
+{
+    checkTransactionOwnership();
+
+    return getCommandQueue().submit<std::vector<uint8_t>>(
+        [this, commandId, command]() {
+            return transmitControlCommand(commandId, command);
+        },
+        false);
+}
+
+void
+PcscReaderAdapter::transmitControlCommandAsync(
+    const int commandId,
+    const std::vector<uint8_t>& command,
+    const DataCallback& callback)
+{
+    checkTransactionOwnership();
+
+    getCommandQueue().execute(
+        [this, commandId, command, callback]() {
+            std::vector<uint8_t> response;
+            std::exception_ptr error;
+            try {
+                response = transmitControlCommand(commandId, command);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            callback(response, error);
+        },
+        [callback]() { callback(std::vector<uint8_t>(), abandonmentError()); },
+        false);
+}
+
+std::future<void>
+PcscReaderAdapter::connectAsync()
+{
+    return getCommandQueue().submit<void>(
+        [this]() { openPhysicalChannel(); }, false);
+}
+
+void
+PcscReaderAdapter::connectAsync(const CompletionCallback& callback)
+{
+    getCommandQueue().execute(
+        [this, callback]() {
+            std::exception_ptr error;
+            try {
+                openPhysicalChannel();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            callback(error);
+        },
+        [callback]() { callback(abandonmentError()); },
+        false);
+}
+
+void
+PcscReaderAdapter::waitForCardPresentAsync(
+    const long timeout, const PresenceCallback& callback)
+{
+    waitForCardPresenceAsync(true, timeout, callback);
+}
+
+void
+PcscReaderAdapter::waitForCardAbsentAsync(
+    const long timeout, const PresenceCallback& callback)
+{
+    waitForCardPresenceAsync(false, timeout, callback);
+}
+
+void
+PcscReaderAdapter::waitForCardPresenceAsync(
+    const bool isPresent,
+    const long timeout,
+    const PresenceCallback& callback)
+{
+    if (timeout <= 0) {
+        throw IllegalArgumentException("timeout must be positive");
+    }
+
+    const auto deadline
+        = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+    getCommandQueue().execute(
+        [this, isPresent, deadline, callback]() {
+            pollCardPresence(isPresent, deadline, callback);
+        },
+        [callback]() { callback(false, abandonmentError()); },
+        false);
+}
+
+void
+PcscReaderAdapter::pollCardPresence(
+    const bool isPresent,
+    const std::chrono::steady_clock::time_point deadline,
+    const PresenceCallback& callback)
+{
+    bool isOccurred = false;
+    std::exception_ptr error;
+    try {
+        /*
+         * Polled rather than waited with SCardGetStatusChange, which would
+         * hold a possibly shared context, and the worker, for the whole wait.
+         */
+        isOccurred = mTerminal->isCardPresent() == isPresent;
+        if (!isOccurred && std::chrono::steady_clock::now() < deadline) {
+            mCommandQueue->postDelayed(
+                [this, isPresent, deadline, callback]() {
+                    pollCardPresence(isPresent, deadline, callback);
+                },
+                10,
+                [callback]() { callback(false, abandonmentError()); });
+            return;
+        }
+
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    callback(isOccurred, error);
+}
+
+PcscReader::CommandQueueStatistics
+PcscReaderAdapter::getCommandQueueStatistics()
+{
+    if (mCommandQueue == nullptr) {
+        return CommandQueueStatistics();
+    }
+
+    return mCommandQueue->getStatistics();
+}
+
 } /* namespace pcsc */
 } /* namespace plugin */
 } /* namespace keyple */
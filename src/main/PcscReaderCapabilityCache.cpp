@@ -0,0 +1,168 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#include "keyple/plugin/pcsc/PcscReaderCapabilityCache.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "keyple/core/util/HexUtil.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+using keyple::core::util::HexUtil;
+
+const std::string PcscReaderCapabilityCache::UNKNOWN_FEATURES = "?";
+const std::string PcscReaderCapabilityCache::NO_FEATURES = "-";
+
+PcscReaderCapabilityCache::PcscReaderCapabilityCache(const std::string& path)
+: mPath(path)
+{
+    load();
+}
+
+bool
+PcscReaderCapabilityCache::restore(PcscReaderProfile& profile) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto it = mEntries.find(profile.getReaderName());
+    if (it == mEntries.end()) {
+        return false;
+    }
+
+    profile.restore(it->second.mFirmwareVersion, it->second.mMaxInputSize);
+
+    const std::string& features = it->second.mFeatures;
+    if (features == NO_FEATURES) {
+        profile.setFeatures(std::vector<uint8_t>());
+    } else if (features != UNKNOWN_FEATURES && HexUtil::isValid(features)) {
+        profile.setFeatures(HexUtil::toByteArray(features));
+    }
+
+    return true;
+}
+
+void
+PcscReaderCapabilityCache::store(const PcscReaderProfile& profile)
+{
+    Entry entry;
+    entry.mFirmwareVersion = profile.getFirmwareVersion();
+    entry.mMaxInputSize = profile.getMaxInputSize();
+    if (!profile.isFeaturesKnown()) {
+        entry.mFeatures = UNKNOWN_FEATURES;
+    } else {
+        const std::vector<uint8_t> features = profile.getFeatures();
+        entry.mFeatures
+            = features.empty() ? NO_FEATURES : HexUtil::toHex(features);
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto it = mEntries.find(profile.getReaderName());
+    if (it != mEntries.end()
+        && it->second.mFirmwareVersion == entry.mFirmwareVersion
+        && it->second.mMaxInputSize == entry.mMaxInputSize
+        && it->second.mFeatures == entry.mFeatures) {
+        return;
+    }
+
+    mEntries[profile.getReaderName()] = entry;
+
+    save();
+}
+
+void
+PcscReaderCapabilityCache::load()
+{
+    std::ifstream input(mPath);
+    if (!input.is_open()) {
+        mLogger->debug("Reader capability cache [%] not found\n", mPath);
+        return;
+    }
+
+    std::string line;
+    while (std::getline(input, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        std::string name;
+        std::string maxInputSize;
+        Entry entry;
+
+        if (!std::getline(fields, name, '\t')
+            || !std::getline(fields, entry.mFirmwareVersion, '\t')
+            || !std::getline(fields, maxInputSize, '\t')) {
+            mLogger->warn("Malformed reader capability cache entry: %\n", line);
+            continue;
+        }
+
+        entry.mMaxInputSize = std::atoi(maxInputSize.c_str());
+
+        /* Absent from the files written before the features were cached */
+        if (!std::getline(fields, entry.mFeatures, '\t')) {
+            entry.mFeatures = UNKNOWN_FEATURES;
+        }
+
+        mEntries[name] = entry;
+    }
+
+    mLogger->debug(
+        "Reader capability cache [%] loaded: % entries\n",
+        mPath,
+        mEntries.size());
+}
+
+void
+PcscReaderCapabilityCache::save() const
+{
+    /* Write a temporary file first so that a crash never leaves a torn file */
+    const std::string tmpPath = mPath + ".tmp";
+
+    {
+        std::ofstream output(tmpPath, std::ios::trunc);
+        if (!output.is_open()) {
+            mLogger->warn(
+                "Unable to write reader capability cache [%]\n", tmpPath);
+            return;
+        }
+
+        output << "# Keyple PC/SC reader capability cache\n";
+        for (const auto& entry : mEntries) {
+            output << entry.first << '\t' << entry.second.mFirmwareVersion
+                   << '\t' << entry.second.mMaxInputSize << '\t'
+                   << entry.second.mFeatures << '\n';
+        }
+    }
+
+#if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
+    /*
+     * The Windows rename does not replace an existing file. Elsewhere rename
+     * is atomic and removing first would open a window without any file.
+     */
+    std::remove(mPath.c_str());
+#endif
+    if (std::rename(tmpPath.c_str(), mPath.c_str()) != 0) {
+        mLogger->warn("Unable to write reader capability cache [%]\n", mPath);
+    }
+}
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,378 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#include "keyple/plugin/pcsc/PcscReaderCommandQueue.hpp"
+
+#include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+using keyple::core::util::cpp::exception::IllegalStateException;
+
+namespace {
+
+/**
+ * Queue whose operations are executed by the current thread, if any, reset
+ * by the destruction of the queue from one of its operations.
+ */
+thread_local const PcscReaderCommandQueue* tCurrentQueue = nullptr;
+
+} /* namespace */
+
+const int PcscReaderCommandQueue::DRAIN_BATCH_SIZE = 8;
+
+PcscReaderCommandQueue::PcscReaderCommandQueue(
+    const std::string& readerName,
+    const int capacity,
+    const std::shared_ptr<PcscReaderExecutor> executor)
+: mReaderName(readerName)
+, mCapacity(static_cast<size_t>(capacity))
+, mIsStopped(false)
+, mStatistics()
+, mExecutor(executor)
+, mIsScheduled(false)
+, mLifetimeToken(
+      new int(0),
+      [this](int* token) {
+          delete token;
+
+          /* Notified under the lock, the queue may be destroyed once released */
+          std::lock_guard<std::mutex> lock(mMutex);
+          mIsTokenReleased = true;
+          mTokenReleased.notify_all();
+      })
+, mIsTokenReleased(false)
+{
+    if (mExecutor == nullptr) {
+        mWorker = std::thread(&PcscReaderCommandQueue::run, this);
+    }
+}
+
+PcscReaderCommandQueue::~PcscReaderCommandQueue()
+{
+    /* Waits for the delayed continuations being queued, if any */
+    std::shared_ptr<int> lifetimeToken;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        lifetimeToken.swap(mLifetimeToken);
+    }
+
+    lifetimeToken = nullptr;
+
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mTokenReleased.wait(lock, [this]() { return mIsTokenReleased; });
+        mIsStopped = true;
+    }
+
+    mNotEmpty.notify_all();
+    mNotFull.notify_all();
+
+    if (isWorkerThread()) {
+        /*
+         * Destroyed by one of its operations: the worker stops touching the
+         * queue once the operation returns (see run and drain).
+         */
+        tCurrentQueue = nullptr;
+        if (mWorker.joinable()) {
+            mWorker.detach();
+        }
+
+    } else if (mExecutor != nullptr) {
+        /* The operations reference the reader, which owns this queue */
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDrained.wait(lock, [this]() { return !mIsScheduled; });
+
+    } else if (mWorker.joinable()) {
+        mWorker.join();
+    }
+
+    /* The callers waiting for a callback are completed with an error */
+    for (auto& entry : mEntries) {
+        if (entry.mAbandonment) {
+            entry.mAbandonment();
+        }
+    }
+
+    for (auto& delayedEntry : mDelayedEntries) {
+        if (delayedEntry.second.mAbandonment) {
+            delayedEntry.second.mAbandonment();
+        }
+    }
+}
+
+void
+PcscReaderCommandQueue::execute(
+    const std::function<void()>& operation,
+    const std::function<void()>& abandonment,
+    const bool isBlocking)
+{
+    post(operation, abandonment, isBlocking);
+}
+
+void
+PcscReaderCommandQueue::postDelayed(
+    const std::function<void()>& operation,
+    const long delay,
+    const std::function<void()>& abandonment)
+{
+    Entry entry;
+    entry.mOperation = operation;
+    entry.mAbandonment = abandonment;
+
+    if (mExecutor == nullptr) {
+        /* Kept aside until due, the worker executing the other operations */
+        const auto dueTime
+            = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay);
+
+        bool isStopped;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            isStopped = mIsStopped;
+            if (!isStopped) {
+                mDelayedEntries.insert(std::make_pair(dueTime, std::move(entry)));
+            }
+        }
+
+        if (!isStopped) {
+            mNotEmpty.notify_one();
+
+        } else if (abandonment) {
+            abandonment();
+        }
+
+        return;
+    }
+
+    std::weak_ptr<int> lifetimeToken;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        lifetimeToken = mLifetimeToken;
+    }
+
+    mExecutor->schedule(
+        [this, lifetimeToken, entry]() mutable {
+            const std::shared_ptr<int> lifetime = lifetimeToken.lock();
+            if (lifetime != nullptr) {
+                std::unique_lock<std::mutex> lock(mMutex);
+                if (!mIsStopped) {
+                    push(entry, lock);
+                    return;
+                }
+            }
+
+            if (entry.mAbandonment) {
+                entry.mAbandonment();
+            }
+        },
+        delay);
+}
+
+bool
+PcscReaderCommandQueue::isWorkerThread() const
+{
+    return tCurrentQueue == this;
+}
+
+PcscReader::CommandQueueStatistics
+PcscReaderCommandQueue::getStatistics()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    PcscReader::CommandQueueStatistics statistics = mStatistics;
+    statistics.depth = static_cast<int>(mEntries.size());
+
+    return statistics;
+}
+
+void
+PcscReaderCommandQueue::post(
+    const std::function<void()>& operation,
+    const std::function<void()>& abandonment,
+    const bool isBlocking)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    if (isBlocking) {
+        mNotFull.wait(lock, [this]() {
+            return mIsStopped || mEntries.size() < mCapacity;
+        });
+    }
+
+    if (mIsStopped) {
+        throw IllegalStateException(
+            "Reader [" + mReaderName + "]: command queue stopped");
+    }
+
+    if (mEntries.size() >= mCapacity) {
+        mStatistics.rejectedCount++;
+        throw IllegalStateException(
+            "Reader [" + mReaderName + "]: command queue full");
+    }
+
+    Entry entry;
+    entry.mOperation = operation;
+    entry.mAbandonment = abandonment;
+    push(entry, lock);
+}
+
+void
+PcscReaderCommandQueue::push(Entry& entry, std::unique_lock<std::mutex>& lock)
+{
+    entry.mSubmissionTime = std::chrono::steady_clock::now();
+    mEntries.push_back(std::move(entry));
+
+    if (mExecutor == nullptr) {
+        lock.unlock();
+        mNotEmpty.notify_one();
+        return;
+    }
+
+    const bool isScheduled = mIsScheduled;
+    mIsScheduled = true;
+    lock.unlock();
+
+    if (!isScheduled) {
+        mExecutor->execute([this]() { drain(); });
+    }
+}
+
+void
+PcscReaderCommandQueue::promoteDelayedEntries()
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    while (!mDelayedEntries.empty() && mDelayedEntries.begin()->first <= now) {
+        Entry& entry = mDelayedEntries.begin()->second;
+        entry.mSubmissionTime = now;
+        mEntries.push_back(std::move(entry));
+        mDelayedEntries.erase(mDelayedEntries.begin());
+    }
+}
+
+void
+PcscReaderCommandQueue::take(Entry& entry)
+{
+    entry = std::move(mEntries.front());
+    mEntries.pop_front();
+
+    const uint64_t waitTime = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - entry.mSubmissionTime)
+            .count());
+
+    mStatistics.executedCount++;
+    mStatistics.totalWaitTime += waitTime;
+    if (waitTime > mStatistics.maxWaitTime) {
+        mStatistics.maxWaitTime = waitTime;
+    }
+}
+
+void
+PcscReaderCommandQueue::run()
+{
+    mLogger->trace("Reader [%]: command queue started\n", mReaderName);
+
+    tCurrentQueue = this;
+
+    while (true) {
+        Entry entry;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            while (!mIsStopped) {
+                promoteDelayedEntries();
+                if (!mEntries.empty()) {
+                    break;
+                }
+
+                if (mDelayedEntries.empty()) {
+                    mNotEmpty.wait(lock);
+                } else {
+                    mNotEmpty.wait_until(lock, mDelayedEntries.begin()->first);
+                }
+            }
+
+            if (mIsStopped) {
+                break;
+            }
+
+            take(entry);
+        }
+
+        mNotFull.notify_one();
+
+        /* Failures are reported through the future of the operation */
+        entry.mOperation();
+        entry = Entry();
+
+        if (tCurrentQueue == nullptr) {
+            /* The queue has been destroyed by the operation */
+            return;
+        }
+    }
+
+    tCurrentQueue = nullptr;
+
+    mLogger->trace("Reader [%]: command queue stopped\n", mReaderName);
+}
+
+void
+PcscReaderCommandQueue::drain()
+{
+    tCurrentQueue = this;
+
+    for (int i = 0; i < DRAIN_BATCH_SIZE; i++) {
+        Entry entry;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mIsStopped || mEntries.empty()) {
+                break;
+            }
+
+            take(entry);
+        }
+
+        mNotFull.notify_one();
+
+        /* Failures are reported through the future of the operation */
+        entry.mOperation();
+        entry = Entry();
+
+        if (tCurrentQueue == nullptr) {
+            /* The queue has been destroyed by the operation */
+            return;
+        }
+    }
+
+    tCurrentQueue = nullptr;
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    if (!mIsStopped && !mEntries.empty()) {
+        /* Yields the worker to the other readers, the order being kept */
+        lock.unlock();
+        mExecutor->execute([this]() { drain(); });
+        return;
+    }
+
+    mIsScheduled = false;
+
+    /* Notified under the lock, the queue may be destroyed once released */
+    mDrained.notify_all();
+}
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,392 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#include "keyple/plugin/pcsc/PcscReaderExecutor.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "keyple/core/util/cpp/Logger.hpp"
+#include "keyple/core/util/cpp/LoggerFactory.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+using keyple::core::util::cpp::Logger;
+using keyple::core::util::cpp::LoggerFactory;
+
+namespace {
+
+int64_t
+toNanos(const std::chrono::steady_clock::time_point time)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               time.time_since_epoch())
+        .count();
+}
+
+} /* namespace */
+
+struct PcscReaderExecutor::Pool {
+    /**
+     *
+     */
+    struct Worker {
+        std::mutex mMutex;
+        std::deque<std::function<void()>> mTasks;
+    };
+
+    /**
+     *
+     */
+    explicit Pool(const int threadCount);
+
+    /**
+     *
+     */
+    const std::unique_ptr<Logger> mLogger =
+        LoggerFactory::getLogger(typeid(PcscReaderExecutor));
+
+    /**
+     *
+     */
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+
+    /**
+     * Protects the delayed tasks and the parking of the idle workers.
+     */
+    std::mutex mMutex;
+
+    /**
+     * Signaled when a task is queued while workers are idle, or when the
+     * pool is stopped.
+     */
+    std::condition_variable mWakeUp;
+
+    /**
+     * Delayed tasks, by due time.
+     */
+    std::multimap<std::chrono::steady_clock::time_point, std::function<void()>>
+        mDelayedTasks;
+
+    /**
+     * Due time of the first delayed task (steady clock, in nanoseconds),
+     * checked by the busy workers without locking.
+     */
+    std::atomic<int64_t> mNextDueTime;
+
+    /**
+     * Number of tasks in the worker deques.
+     */
+    std::atomic<int> mPendingCount;
+
+    /**
+     *
+     */
+    std::atomic<int> mIdleCount;
+
+    /**
+     * Worker receiving the next task submitted from outside the pool.
+     */
+    std::atomic<unsigned int> mNextWorker;
+
+    /**
+     *
+     */
+    std::atomic<bool> mIsStopped;
+
+    /**
+     *
+     */
+    std::atomic<uint64_t> mExecutedCount;
+
+    /**
+     *
+     */
+    std::atomic<uint64_t> mStolenCount;
+
+    /**
+     * Queues a task (see PcscReaderExecutor::execute).
+     */
+    void execute(const std::function<void()>& task);
+
+    /**
+     * Appends a task to the deque of a worker.
+     */
+    void push(const size_t index, const std::function<void()>& task);
+
+    /**
+     * Takes the next task of a worker, or steals one from another worker.
+     *
+     * @return False if all the deques are empty.
+     */
+    bool take(const size_t index, std::function<void()>& task);
+
+    /**
+     * Moves the delayed tasks that are due to the deque of a worker; mMutex
+     * must be held.
+     *
+     * @return The number of tasks moved.
+     */
+    int promoteDueTasks(const size_t index);
+
+    /**
+     * Executes tasks until the pool is stopped.
+     */
+    void run(const size_t index);
+};
+
+namespace {
+
+/**
+ * Pool and index of the worker running on the current thread, if any.
+ */
+thread_local const void* tPool = nullptr;
+thread_local size_t tWorkerIndex = 0;
+
+} /* namespace */
+
+PcscReaderExecutor::Pool::Pool(const int threadCount)
+: mNextDueTime(std::numeric_limits<int64_t>::max())
+, mPendingCount(0)
+, mIdleCount(0)
+, mNextWorker(0)
+, mIsStopped(false)
+, mExecutedCount(0)
+, mStolenCount(0)
+{
+    for (int i = 0; i < threadCount; i++) {
+        mWorkers.push_back(std::unique_ptr<Worker>(new Worker()));
+    }
+}
+
+PcscReaderExecutor::PcscReaderExecutor(const int threadCount)
+: mPool(std::make_shared<Pool>(threadCount))
+{
+    /* The workers own the pool, so that it outlives them */
+    const std::shared_ptr<Pool> pool = mPool;
+    for (int i = 0; i < threadCount; i++) {
+        const size_t index = static_cast<size_t>(i);
+        mThreads.push_back(std::thread([pool, index]() { pool->run(index); }));
+    }
+
+    mPool->mLogger->debug(
+        "Reader executor started with % workers\n", threadCount);
+}
+
+PcscReaderExecutor::~PcscReaderExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mPool->mMutex);
+        mPool->mIsStopped = true;
+    }
+
+    mPool->mWakeUp.notify_all();
+
+    for (std::thread& thread : mThreads) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+            /* Released by one of its own tasks, the worker can not join itself */
+            thread.detach();
+
+        } else if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    mPool->mLogger->debug(
+        "Reader executor stopped: % tasks executed, % stolen\n",
+        mPool->mExecutedCount.load(),
+        mPool->mStolenCount.load());
+}
+
+void
+PcscReaderExecutor::execute(const std::function<void()>& task)
+{
+    mPool->execute(task);
+}
+
+void
+PcscReaderExecutor::schedule(
+    const std::function<void()>& task, const long delay)
+{
+    std::lock_guard<std::mutex> lock(mPool->mMutex);
+
+    mPool->mDelayedTasks.insert(std::make_pair(
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(delay),
+        task));
+    mPool->mNextDueTime = toNanos(mPool->mDelayedTasks.begin()->first);
+
+    /* An idle worker may have to wake up earlier than planned */
+    mPool->mWakeUp.notify_one();
+}
+
+int
+PcscReaderExecutor::getThreadCount() const
+{
+    return static_cast<int>(mPool->mWorkers.size());
+}
+
+void
+PcscReaderExecutor::Pool::execute(const std::function<void()>& task)
+{
+    const size_t index
+        = tPool == this ? tWorkerIndex
+                        : mNextWorker.fetch_add(1) % mWorkers.size();
+
+    push(index, task);
+
+    if (mIdleCount.load() > 0) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mWakeUp.notify_one();
+    }
+}
+
+void
+PcscReaderExecutor::Pool::push(
+    const size_t index, const std::function<void()>& task)
+{
+    Worker& worker = *mWorkers[index];
+    {
+        std::lock_guard<std::mutex> lock(worker.mMutex);
+        worker.mTasks.push_back(task);
+    }
+
+    /* Counted after the push, so that a worker seeing it finds the task */
+    mPendingCount++;
+}
+
+bool
+PcscReaderExecutor::Pool::take(const size_t index, std::function<void()>& task)
+{
+    {
+        Worker& worker = *mWorkers[index];
+        std::lock_guard<std::mutex> lock(worker.mMutex);
+        if (!worker.mTasks.empty()) {
+            task = std::move(worker.mTasks.front());
+            worker.mTasks.pop_front();
+            mPendingCount--;
+            return true;
+        }
+    }
+
+    if (mPendingCount.load() <= 0) {
+        return false;
+    }
+
+    /* Steals from the opposite end, the most recently queued task */
+    for (size_t i = 1; i < mWorkers.size(); i++) {
+        Worker& victim = *mWorkers[(index + i) % mWorkers.size()];
+        std::lock_guard<std::mutex> lock(victim.mMutex);
+        if (!victim.mTasks.empty()) {
+            task = std::move(victim.mTasks.back());
+            victim.mTasks.pop_back();
+            mPendingCount--;
+            mStolenCount++;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int
+PcscReaderExecutor::Pool::promoteDueTasks(const size_t index)
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    int count = 0;
+    while (!mDelayedTasks.empty() && mDelayedTasks.begin()->first <= now) {
+        push(index, mDelayedTasks.begin()->second);
+        mDelayedTasks.erase(mDelayedTasks.begin());
+        count++;
+    }
+
+    mNextDueTime = mDelayedTasks.empty()
+                       ? std::numeric_limits<int64_t>::max()
+                       : toNanos(mDelayedTasks.begin()->first);
+
+    return count;
+}
+
+void
+PcscReaderExecutor::Pool::run(const size_t index)
+{
+    tPool = this;
+    tWorkerIndex = index;
+
+    std::function<void()> task;
+
+    while (!mIsStopped) {
+        if (toNanos(std::chrono::steady_clock::now()) >= mNextDueTime.load()) {
+            int count;
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                count = promoteDueTasks(index);
+            }
+
+            /* The other tasks are left to the idle workers, if any */
+            if (count > 1 && mIdleCount.load() > 0) {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mWakeUp.notify_all();
+            }
+        }
+
+        if (take(index, task)) {
+            try {
+                task();
+
+            } catch (const std::exception& e) {
+                mLogger->error(
+                    "Reader executor: task failed: %\n", std::string(e.what()));
+
+            } catch (...) {
+                mLogger->error("Reader executor: task failed\n");
+            }
+
+            task = nullptr;
+            mExecutedCount++;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mIdleCount++;
+
+        /*
+         * Checked once registered as idle: a task queued meanwhile is either
+         * seen here or notified.
+         */
+        if (!mIsStopped && mPendingCount.load() <= 0) {
+            if (mDelayedTasks.empty()) {
+                mWakeUp.wait(lock);
+            } else {
+                mWakeUp.wait_until(lock, mDelayedTasks.begin()->first);
+            }
+        }
+
+        mIdleCount--;
+    }
+}
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,205 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#include "keyple/plugin/pcsc/PcscReaderProfile.hpp"
+
+#include <cctype>
+#include <sstream>
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+namespace {
+
+/**
+ * Words designating a slot rather than a device in the reader names.
+ */
+const char* const SLOT_KEYWORDS[]
+    = {"PICC", "SAM", "ICC", "CL", "CONTACTLESS", "CONTACT", "SLOT"};
+
+bool
+isSlotKeyword(const std::string& word)
+{
+    std::string upper;
+    for (const char c : word) {
+        upper += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+
+    for (const char* const keyword : SLOT_KEYWORDS) {
+        if (upper == keyword) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool
+isHexByte(const std::string& s, const size_t pos)
+{
+    return std::isxdigit(static_cast<unsigned char>(s[pos]))
+           && std::isxdigit(static_cast<unsigned char>(s[pos + 1]));
+}
+
+}
+
+PcscReaderProfile::PcscReaderProfile(
+    const std::string& readerName, const bool isContactless)
+: mReaderName(readerName)
+, mIsContactless(isContactless)
+, mDeviceName(getDeviceName(readerName))
+, mMaxInputSize(-1)
+, mIsValidated(false)
+, mIsFeaturesKnown(false)
+{
+}
+
+const std::string&
+PcscReaderProfile::getReaderName() const
+{
+    return mReaderName;
+}
+
+bool
+PcscReaderProfile::isContactless() const
+{
+    return mIsContactless;
+}
+
+const std::string&
+PcscReaderProfile::getDeviceName() const
+{
+    return mDeviceName;
+}
+
+std::string
+PcscReaderProfile::getDeviceName(const std::string& readerName)
+{
+    std::string name = readerName;
+
+    /* pcsc-lite: remove the interface name */
+    const size_t open = name.find(" [");
+    if (open != std::string::npos) {
+        const size_t close = name.find(']', open);
+        if (close != std::string::npos) {
+            name.erase(open, close - open + 1);
+        }
+    }
+
+    /* pcsc-lite: remove the slot index of the trailing "NN MM" */
+    const size_t len = name.size();
+    if (len >= 6 && name[len - 6] == ' ' && isHexByte(name, len - 5)
+        && name[len - 3] == ' ' && isHexByte(name, len - 2)) {
+        name.erase(len - 3);
+    }
+
+    /* Windows: remove the slot keywords */
+    std::istringstream words(name);
+    std::string word;
+    std::string deviceName;
+    while (words >> word) {
+        if (isSlotKeyword(word)) {
+            continue;
+        }
+
+        if (!deviceName.empty()) {
+            deviceName += ' ';
+        }
+
+        deviceName += word;
+    }
+
+    return deviceName.empty() ? readerName : deviceName;
+}
+
+std::string
+PcscReaderProfile::getFirmwareVersion() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mFirmwareVersion;
+}
+
+int
+PcscReaderProfile::getMaxInputSize() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mMaxInputSize;
+}
+
+bool
+PcscReaderProfile::isValidated() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mIsValidated;
+}
+
+bool
+PcscReaderProfile::isFeaturesKnown() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mIsFeaturesKnown;
+}
+
+std::vector<uint8_t>
+PcscReaderProfile::getFeatures() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mFeatures;
+}
+
+void
+PcscReaderProfile::setFeatures(const std::vector<uint8_t>& features)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mFeatures = features;
+    mIsFeaturesKnown = true;
+}
+
+void
+PcscReaderProfile::restore(
+    const std::string& firmwareVersion, const int maxInputSize)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mFirmwareVersion = firmwareVersion;
+    mMaxInputSize = maxInputSize;
+    mIsValidated = false;
+}
+
+void
+PcscReaderProfile::validate(
+    const std::string& firmwareVersion, const int maxInputSize)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (firmwareVersion != mFirmwareVersion) {
+        mFeatures.clear();
+        mIsFeaturesKnown = false;
+    }
+
+    mFirmwareVersion = firmwareVersion;
+    mMaxInputSize = maxInputSize;
+    mIsValidated = true;
+}
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
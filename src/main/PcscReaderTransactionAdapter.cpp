@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#include "keyple/plugin/pcsc/PcscReaderTransactionAdapter.hpp"
+
+#include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+
+using keyple::core::util::cpp::exception::IllegalStateException;
+
+PcscReaderTransactionAdapter::PcscReaderTransactionAdapter(
+    const std::function<void()>& endExclusive,
+    const std::shared_ptr<Lock> lock)
+: mEndExclusive(endExclusive)
+, mLock(lock)
+, mIsEnded(false)
+{
+}
+
+PcscReaderTransactionAdapter::~PcscReaderTransactionAdapter()
+{
+    try {
+        end();
+
+    } catch (const IllegalStateException& e) {
+        mLogger->warn("Transaction not ended properly: %\n", e.getMessage());
+    }
+}
+
+void
+PcscReaderTransactionAdapter::end()
+{
+    if (mIsEnded) {
+        return;
+    }
+
+    mIsEnded = true;
+
+    /*
+     * The PC/SC transaction is ended before the lock is released, so that the
+     * next transaction can not begin meanwhile, and the lock is released even
+     * if it cannot be ended.
+     */
+    try {
+        if (mEndExclusive) {
+            mEndExclusive();
+        }
+
+    } catch (...) {
+        releaseLock();
+        throw;
+    }
+
+    releaseLock();
+}
+
+void
+PcscReaderTransactionAdapter::releaseLock()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock->mutex);
+        mLock->owner.store(std::thread::id());
+    }
+
+    mLock->released.notify_all();
+}
+
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,288 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+#include "keyple/plugin/pcsc/cpp/AccessCoordinator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+
+#if !defined(WIN32) && !defined(__MINGW32__) && !defined(__MINGW64__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "PcscUtils.hpp"
+
+#include "keyple/core/util/cpp/Thread.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+namespace cpp {
+
+using keyple::core::util::cpp::Thread;
+
+const int AccessCoordinator::INITIAL_BACKOFF;
+const int AccessCoordinator::TICKET_LEASE;
+
+AccessCoordinator::AccessCoordinator(
+    const int maxAttempts,
+    const int maxBackoff,
+    const bool isCrossProcessLock)
+: mMaxAttempts(std::max(maxAttempts, 1))
+, mMaxBackoff(std::max(maxBackoff, 0))
+, mIsCrossProcessLock(isCrossProcessLock)
+, mContendedAccessCount(0)
+, mFailedAccessCount(0)
+, mTotalWaitTime(0)
+, mMaxWaitTime(0)
+{
+#if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
+    if (mIsCrossProcessLock) {
+        mLogger->warn("Cross-process access lock not available, ignored\n");
+    }
+#endif
+}
+
+AccessCoordinator::~AccessCoordinator()
+{
+#if !defined(WIN32) && !defined(__MINGW32__) && !defined(__MINGW64__)
+    for (const auto& entry : mTicketLocks) {
+        munmap(entry.second, sizeof(SharedTicketLock));
+    }
+#endif
+}
+
+LONG
+AccessCoordinator::execute(
+    const std::string& readerName, const std::function<LONG()>& access)
+{
+    SharedTicketLock* ticketLock
+        = mIsCrossProcessLock ? getTicketLock(readerName) : nullptr;
+
+    std::chrono::steady_clock::duration waitTime
+        = std::chrono::steady_clock::duration::zero();
+    int attempt = 0;
+    LONG rv;
+
+    while (true) {
+        attempt++;
+
+        uint32_t ticket = 0;
+        if (ticketLock != nullptr) {
+            const auto start = std::chrono::steady_clock::now();
+            ticket = acquire(ticketLock);
+            waitTime += std::chrono::steady_clock::now() - start;
+        }
+
+        rv = access();
+
+        if (ticketLock != nullptr) {
+            release(ticketLock, ticket);
+        }
+
+        if (rv != static_cast<LONG>(SCARD_E_SHARING_VIOLATION)
+            || attempt >= mMaxAttempts) {
+            break;
+        }
+
+        /* Back off out of the queue, the next attempt takes a new ticket */
+        const auto start = std::chrono::steady_clock::now();
+        Thread::sleep(getBackoff(attempt));
+        waitTime += std::chrono::steady_clock::now() - start;
+    }
+
+    const uint64_t waited = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(waitTime)
+            .count());
+
+    /* Uncontended ticket acquisitions are not worth reporting */
+    if (attempt > 1 || waited >= 1000) {
+        mContendedAccessCount++;
+        mTotalWaitTime += waited;
+
+        uint64_t max = mMaxWaitTime;
+        while (waited > max && !mMaxWaitTime.compare_exchange_weak(max, waited)) {
+        }
+
+        mLogger->debug(
+            "Reader [%]: access after % attempt(s), waited % us (contended " \
+            "accesses: %, total wait: % us, max wait: % us)\n",
+            readerName,
+            attempt,
+            waited,
+            mContendedAccessCount.load(),
+            mTotalWaitTime.load(),
+            mMaxWaitTime.load());
+    }
+
+    if (rv == static_cast<LONG>(SCARD_E_SHARING_VIOLATION)) {
+        mFailedAccessCount++;
+        mLogger->warn(
+            "Reader [%]: access still refused after % attempt(s)\n",
+            readerName,
+            attempt);
+    }
+
+    return rv;
+}
+
+uint64_t
+AccessCoordinator::getContendedAccessCount() const
+{
+    return mContendedAccessCount;
+}
+
+uint64_t
+AccessCoordinator::getFailedAccessCount() const
+{
+    return mFailedAccessCount;
+}
+
+uint64_t
+AccessCoordinator::getTotalWaitTime() const
+{
+    return mTotalWaitTime;
+}
+
+uint64_t
+AccessCoordinator::getMaxWaitTime() const
+{
+    return mMaxWaitTime;
+}
+
+AccessCoordinator::SharedTicketLock*
+AccessCoordinator::getTicketLock(const std::string& readerName)
+{
+#if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
+    (void)readerName;
+    return nullptr;
+#else
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto it = mTicketLocks.find(readerName);
+    if (it != mTicketLocks.end()) {
+        return it->second;
+    }
+
+    /* Segment name derived from the reader name (FNV-1a) */
+    uint32_t hash = 2166136261u;
+    for (const char c : readerName) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+
+    char name[32];
+    snprintf(name, sizeof(name), "/keyple-pcsc-%08x", hash);
+
+    SharedTicketLock* ticketLock = nullptr;
+
+    /* A new segment is zero-filled, i.e. a free lock */
+    const int fd = shm_open(name, O_RDWR | O_CREAT, 0666);
+    if (fd >= 0) {
+        if (ftruncate(fd, sizeof(SharedTicketLock)) == 0) {
+            void* addr = mmap(
+                NULL,
+                sizeof(SharedTicketLock),
+                PROT_READ | PROT_WRITE,
+                MAP_SHARED,
+                fd,
+                0);
+            if (addr != MAP_FAILED) {
+                ticketLock = static_cast<SharedTicketLock*>(addr);
+            }
+        }
+        close(fd);
+    }
+
+    if (ticketLock == nullptr) {
+        mLogger->warn(
+            "Reader [%]: shared memory % not available, cross-process " \
+            "access lock disabled\n",
+            readerName,
+            std::string(name));
+    }
+
+    mTicketLocks[readerName] = ticketLock;
+
+    return ticketLock;
+#endif
+}
+
+uint32_t
+AccessCoordinator::acquire(SharedTicketLock* ticketLock)
+{
+    const uint32_t ticket = ticketLock->mNextTicket.fetch_add(1);
+
+    uint32_t serving = ticketLock->mServingTicket.load();
+    auto servingSince = std::chrono::steady_clock::now();
+
+    /* Signed difference, the counters wrap around */
+    while (static_cast<int32_t>(ticket - serving) > 0) {
+        Thread::sleep(1);
+
+        const uint32_t current = ticketLock->mServingTicket.load();
+        const auto now = std::chrono::steady_clock::now();
+
+        if (current != serving) {
+            serving = current;
+            servingSince = now;
+
+        } else if (now - servingSince
+                   > std::chrono::milliseconds(TICKET_LEASE)) {
+            /* The holder did not release its ticket in time, skip it */
+            ticketLock->mServingTicket.compare_exchange_strong(
+                serving, serving + 1);
+            serving = ticketLock->mServingTicket.load();
+            servingSince = now;
+        }
+    }
+
+    return ticket;
+}
+
+void
+AccessCoordinator::release(SharedTicketLock* ticketLock, const uint32_t ticket)
+{
+    /* Has no effect if the ticket has been skipped in the meantime */
+    uint32_t expected = ticket;
+    ticketLock->mServingTicket.compare_exchange_strong(expected, ticket + 1);
+}
+
+int
+AccessCoordinator::getBackoff(const int attempt) const
+{
+    static thread_local std::minstd_rand generator(static_cast<unsigned>(
+        std::hash<std::thread::id>()(std::this_thread::get_id())
+        ^ static_cast<size_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count())));
+
+    /* Exponential, capped, then randomized in its upper half */
+    const int shift = std::min(attempt - 1, 16);
+    const int ceiling = std::min(INITIAL_BACKOFF << shift, mMaxBackoff);
+    if (ceiling <= 1) {
+        return ceiling;
+    }
+
+    std::uniform_int_distribution<int> distribution(ceiling / 2, ceiling);
+
+    return distribution(generator);
+}
+
+} /* namespace cpp */
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -15,30 +15,81 @@
 
 #include "PcscUtils.hpp"
 
+#include "keyple/plugin/pcsc/cpp/CardTerminal.hpp"
+
+#include "keyple/plugin/pcsc/cpp/exception/CardControlNotSupportedException.hpp"
 #include "keyple/plugin/pcsc/cpp/exception/CardException.hpp"
+#include "keyple/plugin/pcsc/cpp/exception/CardNotPresentException.hpp"
 
 namespace keyple {
 namespace plugin {
 namespace pcsc {
 namespace cpp {
 
+using keyple::plugin::pcsc::cpp::exception::CardControlNotSupportedException;
 using keyple::plugin::pcsc::cpp::exception::CardException;
+using keyple::plugin::pcsc::cpp::exception::CardNotPresentException;
 
 Card::Card(
   const std::shared_ptr<CardTerminal> cardTerminal,
   const SCARDHANDLE handle,
   const std::vector<uint8_t> atr,
   const DWORD protocol,
-  const SCARD_IO_REQUEST ioRequest)
+  const SCARD_IO_REQUEST ioRequest,
+  const DWORD shareMode,
+  const DWORD preferredProtocols,
+  const std::shared_ptr<ContextManager> contextManager,
+  const uint64_t contextGeneration)
 : mProtocol(protocol)
 , mIORequest(ioRequest)
 , mHandle(handle)
 , mAtr(atr)
+, mShareMode(shareMode)
+, mPreferredProtocols(preferredProtocols)
 , mCardTerminal(cardTerminal)
+, mContextManager(contextManager)
+, mContextGeneration(contextGeneration)
+, mIsDisconnected(false)
+, mBinding(0)
 {
 
 }
 
+void
+Card::rebind(
+  const SCARDHANDLE handle,
+  const uint8_t* atr,
+  const size_t atrLength,
+  const DWORD protocol,
+  const SCARD_IO_REQUEST ioRequest,
+  const DWORD shareMode,
+  const DWORD preferredProtocols,
+  const std::shared_ptr<ContextManager> contextManager,
+  const uint64_t contextGeneration)
+{
+    mHandle = handle;
+    mAtr.assign(atr, atr + atrLength);
+    mProtocol = protocol;
+    mIORequest = ioRequest;
+    mShareMode = shareMode;
+    mPreferredProtocols = preferredProtocols;
+    mContextManager = contextManager;
+    mContextGeneration = contextGeneration;
+
+    /* The channels of the former connection are rejected from now on */
+    mBinding++;
+    mIsDisconnected = false;
+
+    /* Unless held elsewhere, the basic channel is bound to the connection */
+    if (mBasicChannel != nullptr) {
+        if (mBasicChannel.use_count() == 1) {
+            mBasicChannel->rebind(mBinding);
+        } else {
+            mBasicChannel = nullptr;
+        }
+    }
+}
+
 const std::vector<uint8_t>&
 Card::getATR() const
 {
@@ -48,19 +99,110 @@ Card::getATR() const
 void
 Card::beginExclusive()
 {
-    SCardBeginTransaction(mHandle);
+    const auto beginTransaction = [this]() {
+        return SCardBeginTransaction(mHandle);
+    };
+
+    /* A card shared with other applications may be temporarily refused */
+    const std::shared_ptr<CardTerminal> cardTerminal = mCardTerminal.lock();
+    LONG rv = cardTerminal != nullptr
+                  ? cardTerminal->getAccessCoordinator()->execute(
+                      cardTerminal->getName(), beginTransaction)
+                  : beginTransaction();
+    if (rv != SCARD_S_SUCCESS) {
+        mLogger->error(
+            "SCardBeginTransaction failed with error: %\n",
+            std::string(pcsc_stringify_error(rv)));
+        throw CardException(
+            "SCardBeginTransaction failed: "
+            + std::string(pcsc_stringify_error(rv)));
+    }
 }
 
 void
 Card::endExclusive()
 {
-    SCardEndTransaction(mHandle, SCARD_LEAVE_CARD);
+    LONG rv = SCardEndTransaction(mHandle, SCARD_LEAVE_CARD);
+    if (rv != SCARD_S_SUCCESS) {
+        mLogger->error(
+            "SCardEndTransaction failed with error: %\n",
+            std::string(pcsc_stringify_error(rv)));
+        throw CardException(
+            "SCardEndTransaction failed: "
+            + std::string(pcsc_stringify_error(rv)));
+    }
 }
 
 void
 Card::disconnect(const bool reset)
 {
-    SCardDisconnect(mHandle, reset ? SCARD_RESET_CARD : SCARD_LEAVE_CARD);
+    disconnect(static_cast<DWORD>(reset ? SCARD_RESET_CARD : SCARD_LEAVE_CARD));
+}
+
+void
+Card::disconnect(const DWORD disposition)
+{
+    LONG rv = SCardDisconnect(mHandle, disposition);
+    if (rv != SCARD_S_SUCCESS) {
+        mLogger->debug(
+            "SCardDisconnect failed with error: %\n",
+            std::string(pcsc_stringify_error(rv)));
+    }
+
+    /* Last, the object may be rebound as soon as it is set */
+    mIsDisconnected = true;
+}
+
+void
+Card::reconnect(const DWORD initialization)
+{
+    reconnect(mShareMode, mPreferredProtocols, initialization);
+}
+
+void
+Card::reconnect(
+    const DWORD shareMode,
+    const DWORD preferredProtocols,
+    const DWORD initialization)
+{
+    DWORD dwProtocol;
+
+    LONG rv = SCardReconnect(
+        mHandle, shareMode, preferredProtocols, initialization, &dwProtocol);
+    if (rv == static_cast<LONG>(SCARD_W_REMOVED_CARD)) {
+        throw CardNotPresentException("Card not present.");
+
+    } else if (rv != SCARD_S_SUCCESS) {
+        mLogger->debug(
+            "SCardReconnect failed with error: %\n",
+            std::string(pcsc_stringify_error(rv)));
+        throw CardException("SCardReconnect failed");
+    }
+
+    mShareMode = shareMode;
+    mPreferredProtocols = preferredProtocols;
+    mProtocol = dwProtocol;
+
+    switch (dwProtocol) {
+    case SCARD_PROTOCOL_T0:
+        mIORequest = *SCARD_PCI_T0;
+        break;
+    case SCARD_PROTOCOL_T1:
+        mIORequest = *SCARD_PCI_T1;
+        break;
+    }
+
+    /* The ATR may differ after a reset */
+    DWORD readerLength;
+    BYTE _atr[33];
+    DWORD atrLen = sizeof(_atr);
+    DWORD state;
+
+    rv = SCardStatus(
+        mHandle, NULL, &readerLength, &state, &dwProtocol, _atr, &atrLen);
+    if (rv == SCARD_S_SUCCESS) {
+        mAtr.assign(_atr, _atr + atrLen);
+    }
 }
 
 const std::string
@@ -79,24 +221,46 @@ Card::getProtocol() const
 std::shared_ptr<CardChannel>
 Card::getBasicChannel()
 {
-    return std::make_shared<CardChannel>(shared_from_this(), 0);
+    if (mBasicChannel == nullptr) {
+        mBasicChannel = std::make_shared<CardChannel>(shared_from_this(), 0);
+    }
+
+    return mBasicChannel;
 }
 
 const std::vector<uint8_t>
 Card::transmitControlCommand(
     const int commandId, const std::vector<uint8_t>& command)
 {
-    char r_apdu[261];
-    DWORD dwRecv = sizeof(r_apdu);
+    /*
+     * Some answers (e.g. feature lists, TLV properties) exceed a short APDU
+     * response: the buffer is sized for the largest extended response once
+     * per card, and only the actual response is copied out of it.
+     */
+    if (mControlResponseBuffer.empty()) {
+        mControlResponseBuffer.resize(MAX_BUFFER_SIZE_EXTENDED);
+    }
+
+    DWORD dwRecv = 0;
 
     LONG rv = SCardControl(
         mHandle,
         (DWORD)commandId,
         (LPCBYTE)command.data(),
         (DWORD)command.size(),
-        (LPBYTE)r_apdu,
-        (DWORD)sizeof(r_apdu),
+        (LPBYTE)mControlResponseBuffer.data(),
+        (DWORD)mControlResponseBuffer.size(),
         &dwRecv);
+    if (rv == static_cast<LONG>(SCARD_E_UNSUPPORTED_FEATURE)
+#if defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
+        || rv == ERROR_INVALID_FUNCTION || rv == ERROR_NOT_SUPPORTED
+#endif
+    ) {
+        throw CardControlNotSupportedException(
+            "SCardControl not supported: "
+            + std::string(pcsc_stringify_error(rv)));
+    }
+
     if (rv != SCARD_S_SUCCESS) {
         mLogger->error(
             "SCardControl failed with error: %\n",
@@ -104,9 +268,48 @@ Card::transmitControlCommand(
         throw CardException("SCardControl failed");
     }
 
-    std::vector<uint8_t> response(r_apdu, r_apdu + dwRecv);
+    return std::vector<uint8_t>(
+        mControlResponseBuffer.begin(), mControlResponseBuffer.begin() + dwRecv);
+}
+
+const std::vector<uint8_t>
+Card::getAttribute(const DWORD attributeId)
+{
+    DWORD len = 0;
 
-    return response;
+    LONG rv = SCardGetAttrib(mHandle, attributeId, NULL, &len);
+    if (rv == SCARD_S_SUCCESS) {
+        std::vector<uint8_t> attribute(len);
+        rv = SCardGetAttrib(mHandle, attributeId, attribute.data(), &len);
+        if (rv == SCARD_S_SUCCESS) {
+            attribute.resize(len);
+            return attribute;
+        }
+    }
+
+    mLogger->debug(
+        "SCardGetAttrib failed with error: %\n",
+        std::string(pcsc_stringify_error(rv)));
+
+    throw CardException("SCardGetAttrib failed");
+}
+
+bool
+Card::isStale() const
+{
+    return mContextGeneration != mContextManager->getGeneration();
+}
+
+bool
+Card::isDisconnected() const
+{
+    return mIsDisconnected;
+}
+
+uint64_t
+Card::getBinding() const
+{
+    return mBinding;
 }
 
 } /* namespace cpp */
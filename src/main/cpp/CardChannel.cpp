@@ -17,6 +17,7 @@
 
 #include "keyple/core/util/cpp/KeypleStd.hpp"
 #include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
+#include "keyple/core/util/cpp/exception/IllegalStateException.hpp"
 #include "keyple/plugin/pcsc/cpp/Card.hpp"
 #include "keyple/plugin/pcsc/cpp/exception/CardException.hpp"
 
@@ -26,20 +27,44 @@ namespace pcsc {
 namespace cpp {
 
 using keyple::core::util::cpp::exception::IllegalArgumentException;
+using keyple::core::util::cpp::exception::IllegalStateException;
 using keyple::plugin::pcsc::cpp::exception::CardException;
 
 CardChannel::CardChannel(const std::shared_ptr<Card> card, const int channel)
 : mChannel(channel)
 , mIsClosed(true)
 , mCard(card)
+, mBinding(card->getBinding())
+, mGetResponseCount(0)
+, mCase4CommandCount(0)
 {
 
 }
 
+void
+CardChannel::rebind(const uint64_t binding)
+{
+    mBinding = binding;
+    mGetResponseCount = 0;
+    mCase4CommandCount = 0;
+}
+
+uint64_t
+CardChannel::getGetResponseCount() const
+{
+    return mGetResponseCount;
+}
+
+uint64_t
+CardChannel::getCase4CommandCount() const
+{
+    return mCase4CommandCount;
+}
+
 std::shared_ptr<Card>
 CardChannel::getCard() const
 {
-    return mCard;
+    return mCard.lock();
 }
 
 std::vector<uint8_t>
@@ -48,40 +73,53 @@ CardChannel::transmit(const std::vector<uint8_t>& apduIn)
     if (apduIn.size() == 0)
         throw IllegalArgumentException("command cannot be empty");
 
-    /* Make a copy */
-    std::vector<uint8_t> _apduIn = apduIn;
+    /* A channel of a former connection of a recycled card is rejected */
+    const std::shared_ptr<Card> card = mCard.lock();
+    if (card == nullptr || card->isDisconnected()
+        || card->getBinding() != mBinding)
+        throw IllegalStateException("card has been released");
+
+    /*
+     * The application provided command is used as is; it is copied only when
+     * it has to be modified (6Cxx and 61xx handling), which is rare.
+     */
+    const std::vector<uint8_t>* command = &apduIn;
+    std::vector<uint8_t> _apduIn;
 
     /* To check */
     bool t0GetResponse = true;
     bool t1GetResponse = true;
 
-    /*
-     * Note that we modify the 'command' array in some cases, so it must be
-     * a copy of the application provided data
-     */
-    int n = static_cast<int>(_apduIn.size());
-    bool t0 = mCard->mProtocol == SCARD_PROTOCOL_T0;
-    bool t1 = mCard->mProtocol == SCARD_PROTOCOL_T1;
+    int n = static_cast<int>(apduIn.size());
+    bool t0 = card->mProtocol == SCARD_PROTOCOL_T0;
+    bool t1 = card->mProtocol == SCARD_PROTOCOL_T1;
 
-    if (t0 && (n >= 7) && (_apduIn[4] == 0))
+    if (t0 && (n >= 7) && (apduIn[4] == 0))
         throw CardException("Extended len. not supported for T=0");
 
     if ((t0 || t1) && (n >= 7)) {
-        int lc = _apduIn[4] & 0xff;
+        int lc = apduIn[4] & 0xff;
         if (lc != 0) {
             if (n == lc + 6) {
                 n--;
+                mCase4CommandCount++;
             }
         } else {
-            lc = ((_apduIn[5] & 0xff) << 8) | (_apduIn[6] & 0xff);
+            lc = ((apduIn[5] & 0xff) << 8) | (apduIn[6] & 0xff);
             if (n == lc + 9) {
                 n -= 2;
+                mCase4CommandCount++;
             }
         }
     }
 
     bool getresponse = (t0 && t0GetResponse) || (t1 && t1GetResponse);
     int k = 0;
+
+    /*
+     * Each response is received in place at the end of the result, which is
+     * the only allocation of the exchange.
+     */
     std::vector<uint8_t> result;
 
     while (true) {
@@ -89,19 +127,20 @@ CardChannel::transmit(const std::vector<uint8_t>& apduIn)
             throw CardException("Could not obtain response");
         }
 
-        char r_apdu[261];
-        DWORD dwRecv = sizeof(r_apdu);
+        const size_t offset = result.size();
+        result.resize(offset + MAX_SHORT_RESPONSE_SIZE);
+        DWORD dwRecv = MAX_SHORT_RESPONSE_SIZE;
         uint64_t rv;
 
-        mLogger->debug("transmitApdu - c-apdu >> %\n", _apduIn);
+        mLogger->debug("transmitApdu - c-apdu >> %\n", *command);
 
         rv = SCardTransmit(
-            mCard->mHandle,
-            &mCard->mIORequest,
-            (LPCBYTE)_apduIn.data(),
-            static_cast<DWORD>(_apduIn.size()),
+            card->mHandle,
+            &card->mIORequest,
+            (LPCBYTE)command->data(),
+            static_cast<DWORD>(command->size()),
             NULL,
-            (LPBYTE)r_apdu,
+            (LPBYTE)(result.data() + offset),
             &dwRecv);
         if (rv != SCARD_S_SUCCESS) {
             mLogger->error(
@@ -115,44 +154,48 @@ CardChannel::transmit(const std::vector<uint8_t>& apduIn)
             }
         }
 
-        std::vector<uint8_t> response(r_apdu, r_apdu + dwRecv);
+        result.resize(offset + dwRecv);
 
-        mLogger->debug("transmitApdu - r-apdu << %\n", response);
-
-        int rn = static_cast<int>(response.size());
+        const int rn = static_cast<int>(dwRecv);
+        const uint8_t* response = result.data() + offset;
         if (getresponse && (rn >= 2)) {
             /* See ISO 7816/2005, 5.1.3 */
             if ((rn == 2) && (response[0] == 0x6c)) {
                 // Resend command using SW2 as short Le field
+                if (command != &_apduIn) {
+                    _apduIn = apduIn;
+                    command = &_apduIn;
+                }
                 _apduIn[n - 1] = response[1];
+                result.resize(offset);
                 continue;
             }
 
             if (response[rn - 2] == 0x61) {
                 /* Issue a GET RESPONSE command with the same CLA using SW2
-                 * as short Le field */
-                if (rn > 2)
-                    result.insert(
-                        result.end(),
-                        response.begin(),
-                        response.begin() + rn - 2);
-
-                std::vector<uint8_t> getResponse(5);
-                getResponse[0] = _apduIn[0];
-                getResponse[1] = 0xC0;
-                getResponse[2] = 0;
-                getResponse[3] = 0;
-                getResponse[4] = response[rn - 1];
+                 * as short Le field, the status word is dropped */
+                const uint8_t le = response[rn - 1];
+                const uint8_t cla = (*command)[0];
+                result.resize(offset + rn - 2);
+
+                _apduIn.resize(5);
+                _apduIn[0] = cla;
+                _apduIn[1] = 0xC0;
+                _apduIn[2] = 0;
+                _apduIn[3] = 0;
+                _apduIn[4] = le;
                 n = 5;
-                _apduIn.swap(getResponse);
+                command = &_apduIn;
+                mGetResponseCount++;
                 continue;
             }
         }
 
-        result.insert(result.end(), response.begin(), response.begin() + rn);
         break;
     }
 
+    mLogger->debug("transmitApdu - r-apdu << %\n", result);
+
     return result;
 }
 
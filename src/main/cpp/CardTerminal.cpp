@@ -52,6 +52,8 @@ CardTerminal::CardTerminal(
 , const std::string& name)
 : mName(name)
 , mCardTerminals(cardTerminals)
+, mEventCount(-1)
+, mIsDetached(false)
 {
 }
 
@@ -61,11 +63,13 @@ CardTerminal::getName() const
     return mName;
 }
 
-std::shared_ptr<Card>
-CardTerminal::connect(const std::string& protocol)
+void
+CardTerminal::getConnectionParameters(
+    const std::string& protocol,
+    DWORD& dwShareMode,
+    DWORD& dwPreferredProtocols)
 {
-    int dwPreferredProtocols;
-    int dwShareMode = SCARD_SHARE_SHARED;
+    dwShareMode = SCARD_SHARE_SHARED;
 
     std::string _protocol = StringUtils::toupper(protocol);
 
@@ -95,18 +99,50 @@ CardTerminal::connect(const std::string& protocol)
             "Protocol should be one of (prepended with EXCLUSIVE;) T=0, T=1," \
             " *, DIRECT. Got " + protocol);
     }
+}
+
+std::shared_ptr<Card>
+CardTerminal::connect(const std::string& protocol)
+{
+    DWORD dwPreferredProtocols;
+    DWORD dwShareMode;
 
+    getConnectionParameters(protocol, dwShareMode, dwPreferredProtocols);
+
+    return connect(dwShareMode, dwPreferredProtocols);
+}
+
+std::shared_ptr<Card>
+CardTerminal::connect(const DWORD dwShareMode, const DWORD dwPreferredProtocols)
+{
     DWORD dwProtocol;
     SCARDHANDLE handle;
     SCARD_IO_REQUEST ioRequest;
 
-    LONG rv = SCardConnect(
-        mCardTerminals->mContext,
-        (LPCSTR)mName.c_str(),
-        (DWORD)dwShareMode,
-        (DWORD)dwPreferredProtocols,
-        &handle,
-        &dwProtocol);
+    const auto contextManager = mCardTerminals->getReaderContextManager(mName);
+    SCARDCONTEXT context = contextManager->getContext();
+    uint64_t generation = contextManager->getGeneration();
+
+    const auto accessCoordinator = getAccessCoordinator();
+    const auto scardConnect = [&]() {
+        return SCardConnect(
+            context,
+            (LPCSTR)mName.c_str(),
+            (DWORD)dwShareMode,
+            (DWORD)dwPreferredProtocols,
+            &handle,
+            &dwProtocol);
+    };
+
+    /* A reader shared with other applications may be temporarily refused */
+    LONG rv = accessCoordinator->execute(mName, scardConnect);
+
+    if (rv != SCARD_S_SUCCESS && contextManager->recover(rv, generation)) {
+        /* The PC/SC service has been restarted, retry with the new context */
+        context = contextManager->getContext();
+        generation = contextManager->getGeneration();
+        rv = accessCoordinator->execute(mName, scardConnect);
+    }
 
     if (rv == SCARD_S_SUCCESS) {
         switch (dwProtocol) {
@@ -132,26 +168,95 @@ CardTerminal::connect(const std::string& protocol)
             _atr,
             &atrLen);
 
+        std::lock_guard<std::mutex> lock(mRecycledCardMutex);
+
+        /*
+         * The previous card is only reused once explicitly disconnected, its
+         * former channels being then rejected (see Card::rebind).
+         */
+        if (mRecycledCard != nullptr && mRecycledCard->isDisconnected()) {
+            mRecycledCard->rebind(
+                handle,
+                _atr,
+                atrLen,
+                dwProtocol,
+                ioRequest,
+                dwShareMode,
+                dwPreferredProtocols,
+                contextManager,
+                generation);
+
+            return mRecycledCard;
+        }
+
         std::vector<uint8_t> atr(_atr, _atr + atrLen);
 
-        return std::make_shared<Card>(
-            shared_from_this(), handle, atr, dwProtocol, ioRequest);
+        mRecycledCard = std::make_shared<Card>(
+            shared_from_this(),
+            handle,
+            atr,
+            dwProtocol,
+            ioRequest,
+            dwShareMode,
+            dwPreferredProtocols,
+            contextManager,
+            generation);
+
+        return mRecycledCard;
 
     } else if (rv == static_cast<LONG>(SCARD_W_REMOVED_CARD)) {
         throw CardNotPresentException("Card not present.");
 
+    } else if (rv == static_cast<LONG>(SCARD_E_SHARING_VIOLATION)) {
+        throw CardException("Reader in use by another application.");
+
     } else {
         throw RuntimeException("Should not reach here.");
     }
 }
 
+std::shared_ptr<AccessCoordinator>
+CardTerminal::getAccessCoordinator()
+{
+    return mCardTerminals->getAccessCoordinator();
+}
+
 bool
 CardTerminal::isCardPresent()
+{
+    return 0 != (getState() & SCARD_STATE_PRESENT);
+}
+
+DWORD
+CardTerminal::getState()
+{
+    return readState(nullptr);
+}
+
+DWORD
+CardTerminal::getState(std::vector<uint8_t>& atr)
+{
+    return readState(&atr);
+}
+
+DWORD
+CardTerminal::readState(std::vector<uint8_t>* atr)
 {
     SCARD_READERSTATE states[1];
     states[0].szReader = mName.c_str();
+    states[0].pvUserData = NULL;
+    states[0].dwCurrentState = SCARD_STATE_UNAWARE;
+
+    const auto contextManager = mCardTerminals->getReaderContextManager(mName);
+    const SCARDCONTEXT context = contextManager->getContext();
+    const uint64_t generation = contextManager->getGeneration();
+
+    LONG rv = SCardGetStatusChange(context, 0, states, 1);
+    if (rv != SCARD_S_SUCCESS && contextManager->recover(rv, generation)) {
+        /* The PC/SC service has been restarted, retry with the new context */
+        rv = SCardGetStatusChange(contextManager->getContext(), 0, states, 1);
+    }
 
-    LONG rv = SCardGetStatusChange(mCardTerminals->mContext, 0, states, 1);
     if (rv != SCARD_S_SUCCESS) {
         mLogger->error(
             "SCardGetStatusChange failed with error: %\n",
@@ -161,7 +266,49 @@ CardTerminal::isCardPresent()
             std::string(pcsc_stringify_error(rv)));
     }
 
-	return 0 != (states[0].dwEventState & SCARD_STATE_PRESENT);
+    trackEventState(states[0].dwEventState);
+
+    if (atr != nullptr) {
+        if ((states[0].dwEventState & SCARD_STATE_PRESENT) != 0
+            && states[0].cbAtr <= sizeof(states[0].rgbAtr)) {
+            atr->assign(
+                states[0].rgbAtr, states[0].rgbAtr + states[0].cbAtr);
+        } else {
+            atr->clear();
+        }
+    }
+
+    return states[0].dwEventState;
+}
+
+bool
+CardTerminal::isAttached() const
+{
+    return !mIsDetached;
+}
+
+bool
+CardTerminal::trackEventState(const DWORD eventState)
+{
+    if ((eventState & SCARD_STATE_UNKNOWN) != 0) {
+        mIsDetached = true;
+    }
+
+    /*
+     * The counter only grows for a given reader, apart from its wrap-around
+     * after 0xFFFF events.
+     */
+    const int64_t eventCount = eventState >> 16;
+    const int64_t previousEventCount = mEventCount.exchange(eventCount);
+    if (eventCount < previousEventCount
+        && previousEventCount - eventCount < 0x8000) {
+        mLogger->debug(
+            "Reader [%]: card event counter restarted, reader replaced\n",
+            mName);
+        mIsDetached = true;
+    }
+
+    return !mIsDetached;
 }
 
 bool
@@ -13,12 +13,14 @@
 
 #include "keyple/plugin/pcsc/cpp/CardTerminals.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <string>
 
 #include "PcscUtils.hpp"
 
+#include "keyple/core/util/cpp/KeypleStd.hpp"
 #include "keyple/core/util/cpp/exception/IllegalArgumentException.hpp"
 #include "keyple/plugin/pcsc/cpp/exception/CardException.hpp"
 #include "keyple/plugin/pcsc/cpp/exception/CardTerminalException.hpp"
@@ -32,11 +34,60 @@ using keyple::core::util::cpp::exception::IllegalArgumentException;
 using keyple::plugin::pcsc::cpp::exception::CardException;
 using keyple::plugin::pcsc::cpp::exception::CardTerminalException;
 
-CardTerminals::CardTerminals(SCARDCONTEXT& context)
-: mContext(context)
+CardTerminals::CardTerminals(std::shared_ptr<ContextManager> contextManager)
+: mContextManager(contextManager)
+, mContextPool(std::make_shared<ContextPool>(contextManager, ContextMode::SHARED))
+, mAccessCoordinator(std::make_shared<AccessCoordinator>(1, 0, false))
+, mTerminals(std::make_shared<const TerminalList>())
+, mIsPopulated(false)
 {
 }
 
+std::shared_ptr<ContextManager>
+CardTerminals::getReaderContextManager(const std::string& readerName)
+{
+    std::shared_ptr<ContextPool> contextPool;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        contextPool = mContextPool;
+    }
+
+    return contextPool->acquire(readerName);
+}
+
+void
+CardTerminals::setContextMode(const ContextMode mode)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mContextPool->getMode() != mode) {
+        mContextPool = std::make_shared<ContextPool>(mContextManager, mode);
+    }
+}
+
+std::shared_ptr<AccessCoordinator>
+CardTerminals::getAccessCoordinator()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mAccessCoordinator;
+}
+
+void
+CardTerminals::setAccessCoordinator(
+    const std::shared_ptr<AccessCoordinator> accessCoordinator)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mAccessCoordinator = accessCoordinator;
+}
+
+std::shared_ptr<ContextManager>
+CardTerminals::getContextManager() const
+{
+    return mContextManager;
+}
+
 void
 CardTerminals::waitForChange()
 {
@@ -61,7 +112,7 @@ CardTerminals::waitForChange(long timeout)
     }
 
     LONG rv = SCardGetStatusChange(
-        mContext, timeout, mKnownReaders.data(), static_cast<DWORD>(mKnownReaders.size()));
+        mContextManager->getContext(), timeout, mKnownReaders.data(), static_cast<DWORD>(mKnownReaders.size()));
     if (rv == static_cast<LONG>(SCARD_E_TIMEOUT)) {
         return false;
     }
@@ -73,71 +124,230 @@ std::shared_ptr<CardTerminal>
 CardTerminals::getTerminal(const std::string& name)
 {
     try {
-        for (const auto& terminal : list()) {
-            if (terminal->getName() == name) {
-                return terminal;
-            }
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        if (!mIsPopulated) {
+            lock.unlock();
+            std::vector<std::string> addedReaderNames;
+            std::vector<std::string> removedReaderNames;
+            update(addedReaderNames, removedReaderNames);
+            lock.lock();
         }
 
-        return nullptr;
+        const auto it = mTerminalsByName.find(name);
+
+        return it != mTerminalsByName.end() ? it->second : nullptr;
 
     } catch (const CardException&) {
         return nullptr;
     }
 }
 
-const std::vector<std::shared_ptr<CardTerminal>>
+std::shared_ptr<const CardTerminals::TerminalList>
 CardTerminals::list()
 {
     return list(State::ALL);
 }
 
 
-const std::vector<std::shared_ptr<CardTerminal>>
+std::shared_ptr<const CardTerminals::TerminalList>
 CardTerminals::list(const State /*state*/)
 {
-    ULONG ret;
-    char* readers = NULL;
-    char* ptr = NULL;
-    DWORD len = 0;
-    static std::vector<std::shared_ptr<CardTerminal>> list;
+    std::vector<std::string> addedReaderNames;
+    std::vector<std::string> removedReaderNames;
+
+    update(addedReaderNames, removedReaderNames);
 
-    /* Clear list */
-    list.clear();
+    std::lock_guard<std::mutex> lock(mMutex);
 
-    ret = SCardListReaders(mContext, NULL, NULL, &len);
-    if (ret != SCARD_S_SUCCESS) {
+    return mTerminals;
+}
+
+std::shared_ptr<const CardTerminals::TerminalList>
+CardTerminals::getTerminals()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mTerminals;
+}
+
+bool
+CardTerminals::update(
+    std::vector<std::string>& addedReaderNames,
+    std::vector<std::string>& removedReaderNames)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    DWORD len;
+    const SCARDCONTEXT context = mContextManager->getContext();
+    const uint64_t generation = mContextManager->getGeneration();
+
+    LONG ret = listReaders(context, len);
+    if (ret != SCARD_S_SUCCESS && mContextManager->recover(ret, generation)) {
+        /* The PC/SC service has been restarted, retry with the new context */
+        ret = listReaders(mContextManager->getContext(), len);
+    }
+
+    if (ret == static_cast<LONG>(SCARD_E_NO_READERS_AVAILABLE)) {
+        /* Empty multi-string */
+        mReadersBuffer[0] = '\0';
+        len = 1;
+
+    } else if (ret != SCARD_S_SUCCESS) {
         throw CardTerminalException(pcsc_stringify_error(ret));
     }
 
-    readers = static_cast<char*>(calloc(len, sizeof(char)));
+    mIsPopulated = true;
 
-    if (readers == NULL) {
-        /* No readers to add to list */
-        return list;
+    /* Nothing to rebuild if the multi-string did not change */
+    if (len == mReadersSnapshot.size()
+        && std::equal(
+            mReadersSnapshot.begin(),
+            mReadersSnapshot.end(),
+            mReadersBuffer.begin())) {
+        return renewReplacedTerminals(addedReaderNames, removedReaderNames);
     }
 
-    ret = SCardListReaders(mContext, NULL, readers, &len);
-    if (ret != SCARD_S_SUCCESS) {
-        throw CardTerminalException(pcsc_stringify_error(ret));
+    mReadersSnapshot.assign(mReadersBuffer.begin(), mReadersBuffer.begin() + len);
+
+    TerminalList terminals;
+    std::unordered_map<std::string, std::shared_ptr<CardTerminal>>
+        terminalsByName;
+    const char* ptr = mReadersSnapshot.data();
+    const char* end = ptr + mReadersSnapshot.size();
+
+    while (ptr < end && *ptr) {
+        const std::string name(ptr);
+
+        std::shared_ptr<CardTerminal> terminal;
+        auto it = mTerminalsByName.find(name);
+
+        if (it != mTerminalsByName.end()) {
+            terminal = it->second;
+            mTerminalsByName.erase(it);
+        } else {
+            terminal = std::make_shared<CardTerminal>(shared_from_this(), name);
+            addedReaderNames.push_back(name);
+        }
+
+        terminals.push_back(terminal);
+        terminalsByName.insert({name, terminal});
+
+        ptr += name.size() + 1;
+    }
+
+    /* Remaining terminals are those of the removed readers */
+    for (const auto& entry : mTerminalsByName) {
+        removedReaderNames.push_back(entry.first);
+        mContextPool->release(entry.first);
+    }
+
+    mTerminals = std::make_shared<const TerminalList>(std::move(terminals));
+    mTerminalsByName.swap(terminalsByName);
+
+    renewReplacedTerminals(addedReaderNames, removedReaderNames);
+
+    mLogger->debug(
+        "Readers list changed, added: %, removed: %\n",
+        addedReaderNames,
+        removedReaderNames);
+
+    return true;
+}
+
+bool
+CardTerminals::renewReplacedTerminals(
+    std::vector<std::string>& addedReaderNames,
+    std::vector<std::string>& removedReaderNames)
+{
+    const std::shared_ptr<const TerminalList> terminals = mTerminals;
+    if (terminals->empty()) {
+        return false;
+    }
+
+    /* A single round trip for all the readers */
+    mReaderStates.resize(terminals->size());
+    for (size_t i = 0; i < terminals->size(); i++) {
+        mReaderStates[i].szReader = (*terminals)[i]->getName().c_str();
+        mReaderStates[i].pvUserData = NULL;
+        mReaderStates[i].dwCurrentState = SCARD_STATE_UNAWARE;
     }
 
-    ptr = readers;
+    const LONG rv = SCardGetStatusChange(
+        mContextManager->getContext(),
+        0,
+        mReaderStates.data(),
+        static_cast<DWORD>(mReaderStates.size()));
+    if (rv != SCARD_S_SUCCESS) {
+        /* Checked again by the next update */
+        return false;
+    }
+
+    std::unique_ptr<TerminalList> renewedTerminals;
+    for (size_t i = 0; i < terminals->size(); i++) {
+        const std::shared_ptr<CardTerminal>& terminal = (*terminals)[i];
+        const DWORD eventState = mReaderStates[i].dwEventState;
+
+        /* A reader just unplugged is removed by the next update */
+        if ((eventState & SCARD_STATE_UNKNOWN) != 0
+            || terminal->trackEventState(eventState)) {
+            continue;
+        }
+
+        const std::string& name = terminal->getName();
+        const std::shared_ptr<CardTerminal> newTerminal
+            = std::make_shared<CardTerminal>(shared_from_this(), name);
+        newTerminal->trackEventState(eventState);
+
+        if (renewedTerminals == nullptr) {
+            renewedTerminals.reset(new TerminalList(*terminals));
+        }
+
+        (*renewedTerminals)[i] = newTerminal;
+        mTerminalsByName[name] = newTerminal;
+
+        /* The dedicated context, if any, belonged to the former reader */
+        mContextPool->release(name);
+
+        removedReaderNames.push_back(name);
+        addedReaderNames.push_back(name);
 
-    if (!ptr) {
-        return list;
+        mLogger->debug("Reader [%]: terminal renewed\n", name);
     }
 
-    while (*ptr) {
-        std::string s(ptr);
-        auto terminal = std::make_shared<CardTerminal>(shared_from_this(), s);
-        list.push_back(terminal);
-        ptr += strlen(ptr) + 1;
+    if (renewedTerminals == nullptr) {
+        return false;
+    }
+
+    mTerminals
+        = std::make_shared<const TerminalList>(std::move(*renewedTerminals));
+
+    return true;
+}
+
+LONG
+CardTerminals::listReaders(const SCARDCONTEXT context, DWORD& len)
+{
+    if (mReadersBuffer.empty()) {
+        mReadersBuffer.resize(1024);
     }
 
-    free(readers);
+    /* Single call in the nominal case, the buffer is grown when too small */
+    LONG ret;
+    do {
+        len = static_cast<DWORD>(mReadersBuffer.size());
+        ret = SCardListReaders(context, NULL, mReadersBuffer.data(), &len);
+        if (ret == static_cast<LONG>(SCARD_E_INSUFFICIENT_BUFFER)) {
+            len = 0;
+            ret = SCardListReaders(context, NULL, NULL, &len);
+            if (ret == SCARD_S_SUCCESS) {
+                mReadersBuffer.resize(len);
+                ret = static_cast<LONG>(SCARD_E_INSUFFICIENT_BUFFER);
+            }
+        }
+    } while (ret == static_cast<LONG>(SCARD_E_INSUFFICIENT_BUFFER));
 
-    return list;
+    return ret;
 }
 
 } /* namespace cpp */
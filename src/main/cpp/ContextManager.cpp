@@ -0,0 +1,160 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#include "keyple/plugin/pcsc/cpp/ContextManager.hpp"
+
+#include <chrono>
+
+#include "PcscUtils.hpp"
+
+#include "keyple/plugin/pcsc/cpp/exception/CardTerminalException.hpp"
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+namespace cpp {
+
+using keyple::plugin::pcsc::cpp::exception::CardTerminalException;
+
+ContextManager::ContextManager()
+: mContext(0)
+, mIsEstablished(false)
+, mGeneration(0)
+, mLastReestablishmentDuration(0)
+{
+}
+
+ContextManager::~ContextManager()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    release();
+}
+
+SCARDCONTEXT
+ContextManager::getContext()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (!mIsEstablished) {
+        establish();
+    }
+
+    return mContext;
+}
+
+uint64_t
+ContextManager::getGeneration() const
+{
+    return mGeneration;
+}
+
+bool
+ContextManager::recover(const LONG rv, const uint64_t generation)
+{
+    if (!isServiceError(rv)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (generation != mGeneration) {
+        /* Already re-established by another thread */
+        return true;
+    }
+
+    /*
+     * pcsc-lite validates a context against the client side map only, a
+     * context of a restarted daemon still validates: the check is only
+     * meaningful for an invalid handle, the service errors always lead to a
+     * new context.
+     */
+    if (rv == static_cast<LONG>(SCARD_E_INVALID_HANDLE) && mIsEstablished
+        && SCardIsValidContext(mContext) == SCARD_S_SUCCESS) {
+        /* The context is fine, the handle comes from elsewhere */
+        return false;
+    }
+
+    mLogger->warn(
+        "PC/SC context no longer valid (%), re-establishing\n",
+        std::string(pcsc_stringify_error(rv)));
+
+    const auto start = std::chrono::steady_clock::now();
+
+    release();
+
+    try {
+        establish();
+
+    } catch (const CardTerminalException& e) {
+        mLogger->error(
+            "Unable to re-establish the PC/SC context: %\n", e.getMessage());
+        return false;
+    }
+
+    mLastReestablishmentDuration
+        = std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::steady_clock::now() - start)
+              .count();
+
+    mLogger->info(
+        "PC/SC context re-established in % ms (generation %)\n",
+        static_cast<uint64_t>(mLastReestablishmentDuration),
+        static_cast<uint64_t>(mGeneration));
+
+    return true;
+}
+
+uint64_t
+ContextManager::getLastReestablishmentDuration() const
+{
+    return mLastReestablishmentDuration;
+}
+
+bool
+ContextManager::isServiceError(const LONG rv)
+{
+    return rv == static_cast<LONG>(SCARD_E_NO_SERVICE)
+           || rv == static_cast<LONG>(SCARD_E_SERVICE_STOPPED)
+           || rv == static_cast<LONG>(SCARD_E_INVALID_HANDLE);
+}
+
+void
+ContextManager::establish()
+{
+    SCARDCONTEXT context;
+
+    LONG ret = SCardEstablishContext(SCARD_SCOPE_USER, NULL, NULL, &context);
+    if (ret != SCARD_S_SUCCESS) {
+        throw CardTerminalException(pcsc_stringify_error(ret));
+    }
+
+    mContext = context;
+    mIsEstablished = true;
+    mGeneration++;
+}
+
+void
+ContextManager::release()
+{
+    if (mIsEstablished) {
+        /* May fail if the service is gone, nothing to do about it */
+        SCardReleaseContext(mContext);
+        mIsEstablished = false;
+    }
+}
+
+} /* namespace cpp */
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+#include "keyple/plugin/pcsc/cpp/ContextPool.hpp"
+
+#include <vector>
+
+namespace keyple {
+namespace plugin {
+namespace pcsc {
+namespace cpp {
+
+namespace {
+
+/**
+ * Contexts dedicated to the current thread in ContextMode::PER_THREAD mode,
+ * one per pool, released when the thread exits.
+ */
+struct ThreadContext {
+    const ContextPool* mPool;
+    std::weak_ptr<char> mPoolLifetimeToken;
+    std::shared_ptr<ContextManager> mContextManager;
+};
+
+thread_local std::vector<ThreadContext> tThreadContexts;
+
+} /* namespace */
+
+ContextPool::ContextPool(
+    std::shared_ptr<ContextManager> sharedContextManager,
+    const ContextMode mode)
+: mSharedContextManager(sharedContextManager)
+, mMode(mode)
+, mLifetimeToken(std::make_shared<char>(0))
+{
+}
+
+std::shared_ptr<ContextManager>
+ContextPool::acquire(const std::string& readerName)
+{
+    switch (mMode) {
+    case ContextMode::PER_READER: {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto& contextManager = mReaderContexts[readerName];
+        if (contextManager == nullptr) {
+            contextManager = std::make_shared<ContextManager>();
+        }
+        return contextManager;
+    }
+    case ContextMode::PER_THREAD: {
+        /* Thread local, no locking needed */
+        for (auto it = tThreadContexts.begin(); it != tThreadContexts.end();) {
+            if (it->mPoolLifetimeToken.expired()) {
+                /* Context of a destroyed pool, released if no longer used */
+                it = tThreadContexts.erase(it);
+            } else if (it->mPool == this) {
+                return it->mContextManager;
+            } else {
+                ++it;
+            }
+        }
+
+        ThreadContext threadContext;
+        threadContext.mPool = this;
+        threadContext.mPoolLifetimeToken = mLifetimeToken;
+        threadContext.mContextManager = std::make_shared<ContextManager>();
+        tThreadContexts.push_back(threadContext);
+
+        return threadContext.mContextManager;
+    }
+    case ContextMode::SHARED:
+    default:
+        return mSharedContextManager;
+    }
+}
+
+void
+ContextPool::release(const std::string& readerName)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    /* The context is released once the last card using it is gone */
+    mReaderContexts.erase(readerName);
+}
+
+ContextMode
+ContextPool::getMode() const
+{
+    return mMode;
+}
+
+} /* namespace cpp */
+} /* namespace pcsc */
+} /* namespace plugin */
+} /* namespace keyple */
@@ -50,3 +50,27 @@ pcsc_stringify_error(uint64_t rv)
 } // namespace keyple
 
 #endif // defined(WIN32) || defined(__MINGW32__) || defined(__MINGW64__)
+
+/* Reader attributes, defined in reader.h by pcsc-lite */
+#if !defined(WIN32) && !defined(__MINGW32__) && !defined(__MINGW64__) \
+    && !defined(__APPLE__)
+#include <PCSC/reader.h>
+#endif
+
+#ifndef SCARD_ATTR_VENDOR_IFD_VERSION
+#define SCARD_ATTR_VENDOR_IFD_VERSION 0x00010102
+#endif
+
+#ifndef SCARD_ATTR_MAXINPUT
+#define SCARD_ATTR_MAXINPUT 0x0007A007
+#endif
+
+/* Buffer size of a response to a short APDU, as received by SCardTransmit */
+#ifndef MAX_SHORT_RESPONSE_SIZE
+#define MAX_SHORT_RESPONSE_SIZE 261
+#endif
+
+/* Largest extended APDU with its header and status word */
+#ifndef MAX_BUFFER_SIZE_EXTENDED
+#define MAX_BUFFER_SIZE_EXTENDED (4 + 3 + (1 << 16) + 3 + 2)
+#endif
@@ -14,94 +14,68 @@
 #include "keyple/plugin/pcsc/cpp/TerminalFactory.hpp"
 
 #include <cstdint>
-#include <cstring>
 #include <vector>
 
 #include "PcscUtils.hpp"
 
-#include "keyple/plugin/pcsc/cpp/exception/CardTerminalException.hpp"
-
 namespace keyple {
 namespace plugin {
 namespace pcsc {
 namespace cpp {
 
-using keyple::plugin::pcsc::cpp::exception::CardTerminalException;
-
 std::shared_ptr<TerminalFactory> TerminalFactory::mInstance;
 
+std::once_flag TerminalFactory::mInstanceFlag;
+
+TerminalFactory::TerminalFactory()
+: mContextManager(std::make_shared<ContextManager>())
+{
+}
+
 std::shared_ptr<TerminalFactory>
 TerminalFactory::getDefault()
 {
-    if (mInstance == nullptr) {
-        mInstance = std::shared_ptr<TerminalFactory>(new TerminalFactory());
-
-    }
+    std::call_once(mInstanceFlag, []() { mInstance = newInstance(); });
 
     return mInstance;
 }
 
+std::shared_ptr<TerminalFactory>
+TerminalFactory::newInstance()
+{
+    return std::shared_ptr<TerminalFactory>(new TerminalFactory());
+}
+
 const std::vector<std::string>
 TerminalFactory::listTerminals()
 {
-    ULONG ret;
-    char* readers = NULL;
-    char* ptr = NULL;
-    DWORD len = 0;
-    static std::vector<std::string> list;
-
-    /* Clear list */
-    list.clear();
-
-    ret = SCardEstablishContext(SCARD_SCOPE_USER, NULL, NULL, &mContext);
-    if (ret != SCARD_S_SUCCESS) {
-        throw CardTerminalException(pcsc_stringify_error(ret));
-    }
-
-    ret = SCardListReaders(mContext, NULL, NULL, &len);
-    if (ret != SCARD_S_SUCCESS) {
-        throw CardTerminalException(pcsc_stringify_error(ret));
-    }
-
-    readers = static_cast<char*>(calloc(len, sizeof(char)));
-
-    if (readers == NULL) {
-        /* No readers to add to list */
-        return list;
-    }
-
-    ret = SCardListReaders(mContext, NULL, readers, &len);
-    if (ret != SCARD_S_SUCCESS) {
-        throw CardTerminalException(pcsc_stringify_error(ret));
-    }
-
-    ptr = readers;
+    std::vector<std::string> list;
 
-    if (!ptr) {
-        return list;
+    for (const auto& terminal : *terminals()->list()) {
+        list.push_back(terminal->getName());
     }
 
-    while (*ptr) {
-        std::string s(ptr);
-        list.push_back(s);
-        ptr += strlen(ptr) + 1;
-    }
-
-    SCardReleaseContext(mContext);
-    free(readers);
-
     return list;
 }
 
 std::shared_ptr<CardTerminals>
 TerminalFactory::terminals()
 {
-    LONG ret = SCardEstablishContext(SCARD_SCOPE_USER, NULL, NULL, &mContext);
-    if (ret != SCARD_S_SUCCESS) {
-        throw CardTerminalException(pcsc_stringify_error(ret));
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mTerminals == nullptr) {
+        /* Establish the context now to report a missing service early */
+        mContextManager->getContext();
+        mTerminals = std::make_shared<CardTerminals>(mContextManager);
     }
 
-    return std::make_shared<CardTerminals>(mContext);
+    return mTerminals;
+}
+
+std::shared_ptr<ContextManager>
+TerminalFactory::getContextManager() const
+{
+    return mContextManager;
 }
 
 } /* namespace cpp */
@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+/*
+ * Heap allocations and time per tap, a tap being the connection to the card,
+ * the retrieval of its basic channel and the disconnection, as done by the
+ * reader on each card insertion.
+ *
+ * The allocations are counted by replacing the global operator new. In
+ * steady state, once the Card of the terminal is recycled, a tap is expected
+ * to allocate nothing; a transmitted APDU allocates its response.
+ *
+ * Needs a reader with a card, the first one found being used.
+ *
+ * Usage: pcscconnectionbenchmark [taps, 1000 by default]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "keyple/plugin/pcsc/cpp/Card.hpp"
+#include "keyple/plugin/pcsc/cpp/CardChannel.hpp"
+#include "keyple/plugin/pcsc/cpp/CardTerminal.hpp"
+#include "keyple/plugin/pcsc/cpp/CardTerminals.hpp"
+#include "keyple/plugin/pcsc/cpp/TerminalFactory.hpp"
+#include "keyple/plugin/pcsc/cpp/exception/CardException.hpp"
+
+using keyple::plugin::pcsc::cpp::Card;
+using keyple::plugin::pcsc::cpp::CardTerminal;
+using keyple::plugin::pcsc::cpp::CardTerminals;
+using keyple::plugin::pcsc::cpp::TerminalFactory;
+using keyple::plugin::pcsc::cpp::exception::CardException;
+
+namespace {
+
+std::atomic<uint64_t> gAllocationCount(0);
+
+/**
+ * Warm-up taps, the first connection allocating the Card to recycle.
+ */
+const int WARM_UP_TAP_COUNT = 10;
+
+} /* namespace */
+
+void*
+operator new(std::size_t size)
+{
+    gAllocationCount++;
+
+    void* p = std::malloc(size != 0 ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+void
+operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+namespace {
+
+void
+tap(CardTerminal& terminal, const DWORD shareMode, const DWORD protocols)
+{
+    const std::shared_ptr<Card> card = terminal.connect(shareMode, protocols);
+    card->getBasicChannel();
+    card->disconnect(false);
+}
+
+} /* namespace */
+
+int
+main(int argc, char** argv)
+{
+    const int tapCount = argc > 1 ? std::atoi(argv[1]) : 1000;
+    if (tapCount <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [taps]\n";
+        return EXIT_FAILURE;
+    }
+
+    std::shared_ptr<CardTerminal> terminal;
+    for (const auto& candidate :
+         *TerminalFactory::getDefault()->terminals()->list()) {
+        if (candidate->isCardPresent()) {
+            terminal = candidate;
+            break;
+        }
+    }
+
+    if (terminal == nullptr) {
+        std::cerr << "No card present in the connected readers\n";
+        return EXIT_FAILURE;
+    }
+
+    /* Resolved once, as done by the reader when its protocol is set */
+    DWORD shareMode;
+    DWORD protocols;
+    CardTerminal::getConnectionParameters("*", shareMode, protocols);
+
+    try {
+        for (int i = 0; i < WARM_UP_TAP_COUNT; i++) {
+            tap(*terminal, shareMode, protocols);
+        }
+
+        const uint64_t tapAllocationCount = gAllocationCount;
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < tapCount; i++) {
+            tap(*terminal, shareMode, protocols);
+        }
+
+        const auto duration = std::chrono::steady_clock::now() - start;
+        const uint64_t tapAllocations = gAllocationCount - tapAllocationCount;
+
+        /* GET CHALLENGE, any response being fine */
+        const std::vector<uint8_t> apdu = {0x00, 0x84, 0x00, 0x00, 0x08};
+        const std::shared_ptr<Card> card = terminal->connect(shareMode, protocols);
+        const auto channel = card->getBasicChannel();
+
+        const uint64_t transmitAllocationCount = gAllocationCount;
+        for (int i = 0; i < tapCount; i++) {
+            channel->transmit(apdu);
+        }
+
+        const uint64_t transmitAllocations
+            = gAllocationCount - transmitAllocationCount;
+        card->disconnect(false);
+
+        std::cout << "reader: " << terminal->getName() << "\n"
+                  << "taps: " << tapCount << "\n"
+                  << "allocations per tap: "
+                  << static_cast<double>(tapAllocations) / tapCount << "\n"
+                  << "time per tap: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(
+                         duration)
+                             .count()
+                         / tapCount
+                  << " us\n"
+                  << "allocations per APDU: "
+                  << static_cast<double>(transmitAllocations) / tapCount
+                  << "\n";
+
+    } catch (const CardException& e) {
+        std::cerr << "Card error: " << e.getMessage() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
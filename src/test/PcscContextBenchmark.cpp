@@ -0,0 +1,153 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+/*
+ * Throughput of the reader state queries issued in parallel, one thread per
+ * reader, for each context mode (see PcscContextMode).
+ *
+ * pcsc-lite serializes the calls made on a same context: in the SHARED mode,
+ * the throughput stays flat as readers are added, while it grows with their
+ * number in the PER_READER and PER_THREAD modes.
+ *
+ * Needs at least one reader, the cards being optional.
+ *
+ * Usage: pcsccontextbenchmark [queries per reader, 2000 by default]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "keyple/plugin/pcsc/PcscContextMode.hpp"
+#include "keyple/plugin/pcsc/cpp/CardTerminal.hpp"
+#include "keyple/plugin/pcsc/cpp/CardTerminals.hpp"
+#include "keyple/plugin/pcsc/cpp/TerminalFactory.hpp"
+#include "keyple/plugin/pcsc/cpp/exception/CardException.hpp"
+
+using keyple::plugin::pcsc::PcscContextMode;
+using keyple::plugin::pcsc::cpp::CardTerminal;
+using keyple::plugin::pcsc::cpp::CardTerminals;
+using keyple::plugin::pcsc::cpp::TerminalFactory;
+using keyple::plugin::pcsc::cpp::exception::CardException;
+
+namespace {
+
+const char*
+toString(const PcscContextMode mode)
+{
+    switch (mode) {
+    case PcscContextMode::SHARED:
+        return "SHARED";
+    case PcscContextMode::PER_READER:
+        return "PER_READER";
+    default:
+        return "PER_THREAD";
+    }
+}
+
+/**
+ * Queries the state of the first readerCount readers in parallel, and
+ * returns the number of queries per second.
+ */
+double
+run(const CardTerminals::TerminalList& terminals,
+    const size_t readerCount,
+    const int queryCount)
+{
+    std::atomic<int> failureCount(0);
+    std::vector<std::thread> threads;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < readerCount; i++) {
+        const std::shared_ptr<CardTerminal> terminal = terminals[i];
+        threads.emplace_back([terminal, queryCount, &failureCount]() {
+            for (int j = 0; j < queryCount; j++) {
+                try {
+                    terminal->getState();
+
+                } catch (const CardException&) {
+                    failureCount++;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const double seconds
+        = std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+              .count();
+
+    if (failureCount > 0) {
+        std::cerr << failureCount << " failed queries\n";
+    }
+
+    return static_cast<double>(readerCount * queryCount) / seconds;
+}
+
+} /* namespace */
+
+int
+main(int argc, char** argv)
+{
+    const int queryCount = argc > 1 ? std::atoi(argv[1]) : 2000;
+    if (queryCount <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [queries per reader]\n";
+        return EXIT_FAILURE;
+    }
+
+    const std::shared_ptr<CardTerminals> cardTerminals
+        = TerminalFactory::getDefault()->terminals();
+    const std::shared_ptr<const CardTerminals::TerminalList> terminals
+        = cardTerminals->list();
+
+    if (terminals->empty()) {
+        std::cerr << "No reader connected\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "readers  mode        queries/s  speedup\n";
+
+    for (const PcscContextMode mode :
+         {PcscContextMode::SHARED,
+          PcscContextMode::PER_READER,
+          PcscContextMode::PER_THREAD}) {
+        cardTerminals->setContextMode(mode);
+
+        double singleReaderThroughput = 0;
+        for (size_t readerCount = 1; readerCount <= terminals->size();
+             readerCount++) {
+            const double throughput = run(*terminals, readerCount, queryCount);
+            if (readerCount == 1) {
+                singleReaderThroughput = throughput;
+            }
+
+            std::cout << std::setw(7) << readerCount << "  " << std::left
+                      << std::setw(10) << toString(mode) << std::right
+                      << std::setw(11) << std::fixed << std::setprecision(0)
+                      << throughput << std::setw(9) << std::setprecision(2)
+                      << throughput / singleReaderThroughput << "\n";
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,222 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * See the NOTICE file(s) distributed with this work for additional           *
+ * information regarding copyright ownership.                                 *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the Eclipse Public License 2.0 which is available at              *
+ * http://www.eclipse.org/legal/epl-2.0                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: EPL-2.0                                           *
+ ******************************************************************************/
+
+
+/*
+ * Scaling of the reader command queues from 1 to 256 virtual readers, each
+ * queue having its own worker thread or all of them sharing an executor with
+ * one worker per hardware thread (see useReaderExecutor).
+ *
+ * The exchanges are simulated by a busy wait, so that the benchmark measures
+ * the scheduling overhead; an exchange blocking on the PC/SC service holds
+ * its worker meanwhile.
+ *
+ * It also stresses the ordering of the operations of each reader, and the
+ * destruction of queues with pending delayed continuations or from one of
+ * their own operations, and fails if an operation is run out of order or
+ * off the worker. Best run under ThreadSanitizer.
+ *
+ * No reader is needed.
+ *
+ * Usage: pcscreaderexecutorbenchmark [operations per reader, 1000 by default]
+ *                                    [exchange duration in us, 20 by default]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "keyple/plugin/pcsc/PcscReaderCommandQueue.hpp"
+#include "keyple/plugin/pcsc/PcscReaderExecutor.hpp"
+
+using keyple::plugin::pcsc::PcscReaderCommandQueue;
+using keyple::plugin::pcsc::PcscReaderExecutor;
+
+namespace {
+
+/**
+ * Capacity of the queues, the operations of a run being all submitted at
+ * once.
+ */
+const int QUEUE_CAPACITY = 1 << 20;
+
+void
+simulateExchange(const int duration)
+{
+    const auto end = std::chrono::steady_clock::now()
+                     + std::chrono::microseconds(duration);
+    while (std::chrono::steady_clock::now() < end) {
+    }
+}
+
+/**
+ * Runs operationCount operations on each of the readerCount queues, and
+ * returns the number of operations per second.
+ */
+double
+run(const int readerCount,
+    const std::shared_ptr<PcscReaderExecutor> executor,
+    const int operationCount,
+    const int exchangeDuration,
+    std::atomic<int>& errorCount)
+{
+    std::vector<std::unique_ptr<PcscReaderCommandQueue>> queues;
+    for (int i = 0; i < readerCount; i++) {
+        queues.emplace_back(new PcscReaderCommandQueue(
+            "reader " + std::to_string(i), QUEUE_CAPACITY, executor));
+    }
+
+    /* Written by the operations of a queue only, one at a time */
+    std::vector<int> lastOperations(readerCount, -1);
+    std::vector<std::future<void>> completions;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int j = 0; j < operationCount; j++) {
+        for (int i = 0; i < readerCount; i++) {
+            PcscReaderCommandQueue* const queue = queues[i].get();
+            int* const lastOperation = &lastOperations[i];
+
+            std::future<void> completion = queue->submit<void>(
+                [queue, lastOperation, j, exchangeDuration, &errorCount]() {
+                    if (*lastOperation != j - 1 || !queue->isWorkerThread()) {
+                        errorCount++;
+                    }
+
+                    *lastOperation = j;
+                    simulateExchange(exchangeDuration);
+                },
+                false);
+
+            /* Only the last operation of each reader is waited for */
+            if (j == operationCount - 1) {
+                completions.push_back(std::move(completion));
+            }
+        }
+    }
+
+    for (auto& completion : completions) {
+        completion.get();
+    }
+
+    const double seconds
+        = std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+              .count();
+
+    /*
+     * Destroyed with pending delayed continuations, each being either run or
+     * abandoned, the latter at once or when due on an executor.
+     */
+    const auto completedCount = std::make_shared<std::atomic<int>>(0);
+    for (auto& queue : queues) {
+        queue->postDelayed(
+            [completedCount]() { (*completedCount)++; },
+            10,
+            [completedCount]() { (*completedCount)++; });
+    }
+
+    queues.clear();
+
+    const auto deadline
+        = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (*completedCount != readerCount
+           && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    if (*completedCount != readerCount) {
+        errorCount++;
+    }
+
+    return static_cast<double>(readerCount) * operationCount / seconds;
+}
+
+/**
+ * Destroys a queue from one of its own operations.
+ */
+void
+destroyFromOperation(
+    const std::shared_ptr<PcscReaderExecutor> executor,
+    std::atomic<int>& errorCount)
+{
+    auto queue = std::make_shared<PcscReaderCommandQueue>(
+        "reader", QUEUE_CAPACITY, executor);
+    const auto holder
+        = std::make_shared<std::shared_ptr<PcscReaderCommandQueue>>(queue);
+
+    std::promise<void> destroyed;
+    queue->execute(
+        [holder, &destroyed]() {
+            holder->reset();
+            destroyed.set_value();
+        },
+        nullptr,
+        false);
+    queue.reset();
+
+    if (destroyed.get_future().wait_for(std::chrono::seconds(5))
+        != std::future_status::ready) {
+        errorCount++;
+    }
+}
+
+} /* namespace */
+
+int
+main(int argc, char** argv)
+{
+    const int operationCount = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const int exchangeDuration = argc > 2 ? std::atoi(argv[2]) : 20;
+    if (operationCount <= 0 || exchangeDuration < 0) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [operations per reader] [exchange duration in us]\n";
+        return EXIT_FAILURE;
+    }
+
+    const int threadCount
+        = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    const auto executor = std::make_shared<PcscReaderExecutor>(threadCount);
+
+    std::atomic<int> errorCount(0);
+
+    std::cout << "readers  thread per reader (op/s)  executor, " << threadCount
+              << " workers (op/s)\n";
+
+    for (int readerCount = 1; readerCount <= 256; readerCount *= 2) {
+        const double threadPerReaderThroughput = run(
+            readerCount, nullptr, operationCount, exchangeDuration, errorCount);
+        const double executorThroughput = run(
+            readerCount, executor, operationCount, exchangeDuration, errorCount);
+
+        std::cout << std::setw(7) << readerCount << std::setw(26) << std::fixed
+                  << std::setprecision(0) << threadPerReaderThroughput
+                  << std::setw(31) << executorThroughput << "\n";
+    }
+
+    destroyFromOperation(nullptr, errorCount);
+    destroyFromOperation(executor, errorCount);
+
+    if (errorCount > 0) {
+        std::cerr << errorCount << " error(s)\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}